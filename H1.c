@@ -0,0 +1,767 @@
+// H1 stack machine interpreter in C
+//
+// Runs the .a files that S2 and L9 emit without the H1 toolchain.
+// The assembler text is decoded once into an array of instructions
+// whose operands are already resolved: a dw label becomes the
+// address of its word, a code label the index of its instruction.
+// The array is then run as threaded code: each instruction holds
+// the address of its handler, and each handler ends with a jump
+// straight to the handler of the next (computed goto, a gcc and
+// clang extension), so there is no central dispatch loop.
+//
+// With --object it loads name.ho, the binary object file S2
+// writes with --object, instead of decoding text, and with
+// --disassemble it lists the loaded program instead of running it.
+// --profile counts the instructions each source statement runs,
+// using name.map from S2 --line-map if there is one.
+#include <stdio.h>  // needed by I/O functions
+#include <stdlib.h> // needed by malloc and exit
+#include <string.h> // needed by str functions
+#include <ctype.h>  // needed by isdigit, etc.
+#include <time.h>   // needed by clock
+
+// No boolean type in C.
+// Any nonzero number is true.  Zero is false.
+#define TRUE 1
+#define FALSE 0
+
+// Sizes for arrays
+#define MAX 300            // longest line of assembler text
+#define MEMSIZE 65536      // words of data memory, 16-bit addresses
+#define CODESIZE 65536     // instructions
+#define LABELSIZE 4096     // labels
+#define STACKSIZE 65536    // words of stack
+#define OBJMAGIC "H1O1"    // first bytes of an object file
+#define HOTCOUNT 20        // statements in the profile report
+
+// opcodes, in the order of opName
+#define OP_P 0
+#define OP_PC 1
+#define OP_PWC 2
+#define OP_AWC 3
+#define OP_STAV 4
+#define OP_ADD 5
+#define OP_SUB 6
+#define OP_MULT 7
+#define OP_DIV 8
+#define OP_DOUT 9
+#define OP_AOUT 10
+#define OP_SOUT 11
+#define OP_JA 12
+#define OP_JZ 13
+#define OP_JNZ 14
+#define OP_JN 15
+#define OP_JP 16
+#define OP_JZOP 17
+#define OP_JZON 18
+#define OP_HALT 19
+#define OPCOUNT 20
+
+// wrap an int to the 16-bit two's complement range of an H1 word
+#define WRAP(v) ((((v) + 32768) & 0xffff) - 32768)
+
+// Prototypes
+void abend(void);
+
+// Global Variables
+
+char *opName[OPCOUNT] =
+{
+    "p", "pc", "pwc", "awc", "stav", "add", "sub", "mult", "div",
+    "dout", "aout", "sout", "ja", "jz", "jnz", "jn", "jp", "jzop",
+    "jzon", "halt"
+};
+
+// A decoded instruction.  handler is filled in by execute, which
+// owns the labels it points to.
+typedef struct
+{
+    void *handler;
+    int op;
+    int operand;        // address, value, or instruction index
+    int isLabel;        // operand was given as a label
+    int line;           // line of the .a file, or source line
+} INSTR;
+
+INSTR code[CODESIZE];
+int codex;                    // instructions decoded
+
+int initial[MEMSIZE];         // data memory as the dw lines set it
+int mem[MEMSIZE];             // data memory of the run
+int memx;                     // data words used
+
+typedef struct
+{
+    char *name;
+    int value;          // address of a dw, or instruction index
+    int isCode;
+} LABEL;
+
+LABEL labels[LABELSIZE];
+int labelx;
+
+int stack[STACKSIZE];
+
+char inFileName[MAX], inputLine[MAX];
+int lineNumber;
+FILE *inFile;
+
+int quiet = FALSE;            // TRUE: runs after the first print nothing
+int stats = FALSE;            // --stats: report decode and speed
+int repeat = 1;               // --repeat=N: run the program N times
+int object = FALSE;           // --object: load name.ho
+int disassemble = FALSE;      // --disassemble: list, do not run
+int profile = FALSE;          // --profile: runs of each statement
+
+// --profile: executions of each instruction, and its statement
+long long hits[CODESIZE + 1];
+int mapLine[CODESIZE + 1], mapColumn[CODESIZE + 1];
+int order[CODESIZE + 1];      // instructions sorted by statement
+
+//-----------------------------------------
+// Abnormal end.
+void abend(void)
+{
+    fflush(stdout);
+    if (inFile)
+        fclose(inFile);
+    exit(1);
+}
+//-----------------------------------------
+void displayErrorLoc(void)
+{
+    printf("Error on line %d of %s\n", lineNumber, inFileName);
+}
+//-----------------------------------------
+// index of label s, or -1
+int findLabel(char *s)
+{
+    int i;
+    
+    for (i = 0; i < labelx; i++)
+        if (!strcmp(s, labels[i].name))
+            return i;
+    return -1;
+}
+//-----------------------------------------
+void enterLabel(char *s, int value, int isCode)
+{
+    if (findLabel(s) >= 0)
+    {
+        displayErrorLoc();
+        printf("Label %s defined twice\n", s);
+        abend();
+    }
+    if (labelx >= LABELSIZE)
+    {
+        printf("System error: label table overflow\n");
+        abend();
+    }
+    labels[labelx].name = strdup(s);
+    labels[labelx].value = value;
+    labels[labelx++].isCode = isCode;
+}
+//-----------------------------------------
+// Split inputLine into its label, opcode, and operand, each an
+// empty string if absent.  A comment starts at a ; that is not
+// inside quotes.  Returns FALSE for a line with nothing on it.
+int splitLine(char *label, char *op, char *operand)
+{
+    char *p, *q, quote = 0;
+    
+    for (p = inputLine; *p; p++)
+    {
+        if (quote)
+        {
+            if (*p == '\\' && p[1])
+                p++;
+            else if (*p == quote)
+                quote = 0;
+        }
+        else if (*p == '\'' || *p == '"')
+            quote = *p;
+        else if (*p == ';' || *p == '\n')
+            break;
+    }
+    while (p > inputLine && isspace(p[-1]))
+        p--;
+    *p = '\0';
+    
+    label[0] = op[0] = operand[0] = '\0';
+    p = inputLine;
+    if (*p && !isspace(*p))
+    {
+        for (q = label; *p && *p != ':' && !isspace(*p); )
+            *q++ = *p++;
+        *q = '\0';
+        if (*p == ':')
+            p++;
+    }
+    while (isspace(*p))
+        p++;
+    for (q = op; *p && !isspace(*p); )
+        *q++ = *p++;
+    *q = '\0';
+    while (isspace(*p))
+        p++;
+    strcpy(operand, p);
+    return label[0] || op[0];
+}
+//-----------------------------------------
+// value of a number or character constant such as '\n'
+int constant(char *s)
+{
+    if (s[0] == '\'')
+    {
+        if (s[1] != '\\')
+            return s[1];
+        switch(s[2])
+        {
+            case 'n':  return '\n';
+            case 't':  return '\t';
+            case '0':  return '\0';
+            default:   return s[2];
+        }
+    }
+    if (!isdigit(s[0]) && !((s[0] == '-' || s[0] == '+') &&
+                            isdigit(s[1])))
+    {
+        displayErrorLoc();
+        printf("Bad constant %s\n", s);
+        abend();
+    }
+    return WRAP(atoi(s));
+}
+//-----------------------------------------
+// store the string constant s, in quotes, one character per word
+// from address memx, followed by a 0 word
+void storeString(char *s)
+{
+    for (s++; *s && *s != '"'; s++)
+    {
+        if (memx >= MEMSIZE - 1)
+        {
+            printf("System error: data memory overflow\n");
+            abend();
+        }
+        if (*s == '\\' && s[1])
+        {
+            s++;
+            initial[memx++] = *s == 'n' ? '\n' : *s == 't' ? '\t' : *s;
+        }
+        else
+            initial[memx++] = *s;
+    }
+    initial[memx++] = 0;
+}
+//-----------------------------------------
+// opcode named s, or -1
+int opcode(char *s)
+{
+    int i;
+    
+    for (i = 0; i < OPCOUNT; i++)
+        if (!strcmp(s, opName[i]))
+            return i;
+    return -1;
+}
+//-----------------------------------------
+// Decode the .a file.  The first pass places the labels: a dw
+// label at the next data address, any other at the next
+// instruction.  The second pass builds the instructions with their
+// operands resolved.
+void decode(void)
+{
+    char label[MAX], op[MAX], operand[MAX];
+    int pass, i, k;
+    
+    for (pass = 1; pass <= 2; pass++)
+    {
+        rewind(inFile);
+        lineNumber = codex = memx = 0;
+        while (fgets(inputLine, sizeof(inputLine), inFile))
+        {
+            lineNumber++;
+            if (inputLine[0] == '!')
+            {
+                displayErrorLoc();
+                printf("Register instruction set: run it with R1 --run\n");
+                abend();
+            }
+            if (!splitLine(label, op, operand))
+                continue;
+    
+            if (!strcmp(op, "dw"))
+            {
+                if (pass == 1 && label[0])
+                    enterLabel(label, memx, FALSE);
+                if (operand[0] == '"')
+                    storeString(operand);
+                else
+                {
+                    if (memx >= MEMSIZE)
+                    {
+                        printf("System error: data memory overflow\n");
+                        abend();
+                    }
+                    initial[memx++] = pass == 2 ? constant(operand) : 0;
+                }
+                continue;
+            }
+    
+            if (pass == 1 && label[0])
+                enterLabel(label, codex, TRUE);
+            if (!op[0])
+                continue;
+            if (codex >= CODESIZE)
+            {
+                printf("System error: code overflow\n");
+                abend();
+            }
+            if (pass == 1)
+            {
+                codex++;
+                continue;
+            }
+    
+            i = opcode(op);
+            if (i < 0)
+            {
+                displayErrorLoc();
+                printf("Unknown instruction %s\n", op);
+                abend();
+            }
+            code[codex].op = i;
+            code[codex].line = lineNumber;
+            code[codex].operand = 0;
+            code[codex].isLabel = FALSE;
+    
+            if (i == OP_P || i == OP_PC || (i >= OP_JA && i <= OP_JZON))
+            {
+                if (i == OP_PC && (operand[0] == '\'' ||
+                    isdigit(operand[0]) || operand[0] == '-'))
+                    code[codex].operand = constant(operand);
+                else
+                {
+                    k = findLabel(operand);
+                    if (k < 0 || labels[k].isCode != (i >= OP_JA))
+                    {
+                        displayErrorLoc();
+                        printf("Undefined %s %s\n", i >= OP_JA ?
+                               "code label" : "data label", operand);
+                        abend();
+                    }
+                    code[codex].operand = labels[k].value;
+                    code[codex].isLabel = TRUE;
+                }
+            }
+            else if (i == OP_PWC || i == OP_AWC)
+                code[codex].operand = constant(operand);
+            codex++;
+        }
+    }
+    
+    // running off the end of the code stops the program
+    code[codex].op = OP_HALT;
+    code[codex].line = lineNumber;
+}
+//-----------------------------------------
+// little-endian 32-bit field of an object file
+int get32(unsigned char *p)
+{
+    return p[0] | p[1] << 8 | p[2] << 16 | (unsigned)p[3] << 24;
+}
+//-----------------------------------------
+void badObject(void)
+{
+    printf("Error: %s is not a valid object file\n", inFileName);
+    abend();
+}
+//-----------------------------------------
+// Load an object file, read with one fread.  Its layout is given
+// in S2.c; the operands are already resolved, so loading is only
+// unpacking fields.
+void load(void)
+{
+    unsigned char *buffer, *p, *end;
+    long size;
+    int i, dataCount, symbolCount, hasLines, word;
+    
+    fseek(inFile, 0, SEEK_END);
+    size = ftell(inFile);
+    rewind(inFile);
+    buffer = malloc(size + 1);
+    if (!buffer || fread(buffer, 1, size, inFile) != (size_t)size)
+    {
+        printf("Error: Cannot read %s\n", inFileName);
+        abend();
+    }
+    end = buffer + size;
+    buffer[size] = '\0';         // ends the last name
+    
+    if (size < 20 || memcmp(buffer, OBJMAGIC, 4))
+        badObject();
+    codex = get32(buffer + 4);
+    dataCount = get32(buffer + 8);
+    symbolCount = get32(buffer + 12);
+    hasLines = get32(buffer + 16);
+    if (codex < 0 || codex >= CODESIZE || dataCount < 0 ||
+        dataCount > MEMSIZE || symbolCount < 0 ||
+        end - buffer < 20 + 4L * codex + 2L * dataCount)
+        badObject();
+    p = buffer + 20;
+    
+    for (i = 0; i < codex; i++, p += 4)
+    {
+        word = get32(p);
+        code[i].op = word >> 16 & 0xff;
+        code[i].operand = word & 0xffff;
+        code[i].isLabel = word >> 24 & 1;
+        code[i].line = 0;
+        if (code[i].op >= OPCOUNT)
+            badObject();
+        
+        // a jump may go to the end of the code, the implied halt
+        if (code[i].op >= OP_JA && code[i].op <= OP_JZON &&
+            code[i].operand > codex)
+        {
+            printf("Error: instruction %d of %s jumps to %d, past the "
+                   "end of the code\n", i, inFileName, code[i].operand);
+            abend();
+        }
+        if (code[i].op == OP_PC || code[i].op == OP_PWC ||
+            code[i].op == OP_AWC)
+            code[i].operand = WRAP(code[i].operand);
+    }
+    
+    for (memx = 0; memx < dataCount; memx++, p += 2)
+        initial[memx] = WRAP(p[0] | p[1] << 8);
+    
+    for (i = 0; i < symbolCount; i++)
+    {
+        if (end - p < 9)
+            badObject();
+        enterLabel((char *)p + 8, get32(p), get32(p + 4));
+        p += 8 + strlen((char *)p + 8) + 1;
+    }
+    
+    if (hasLines)
+    {
+        if (end - p < 4L * codex)
+            badObject();
+        for (i = 0; i < codex; i++, p += 4)
+            code[i].line = get32(p);
+    }
+    free(buffer);
+    
+    code[codex].op = OP_HALT;
+    code[codex].line = 0;
+}
+//-----------------------------------------
+// name of the label with this value, or NULL
+char *labelName(int value, int isCode)
+{
+    int i;
+    
+    for (i = 0; i < labelx; i++)
+        if (labels[i].value == value && labels[i].isCode == isCode)
+            return labels[i].name;
+    return NULL;
+}
+//-----------------------------------------
+// --disassemble: list the code and the data words, with the labels
+// of the symbol table if there is one
+void listProgram(void)
+{
+    int i;
+    char *name;
+    
+    printf("; %d instructions\n", codex);
+    for (i = 0; i < codex; i++)
+    {
+        name = labelName(i, TRUE);
+        printf("%5d %-9s %-4s", i, name ? name : "", opName[code[i].op]);
+        if (code[i].op <= OP_AWC || (code[i].op >= OP_JA &&
+            code[i].op <= OP_JZON))
+        {
+            name = code[i].isLabel ? labelName(code[i].operand,
+                                               code[i].op >= OP_JA) : NULL;
+            if (name)
+                printf("      %-10s", name);
+            else
+                printf("      %-10d", code[i].operand);
+        }
+        else
+            printf("%16s", "");
+        if (code[i].line)
+            printf(" ; line %d", code[i].line);
+        printf("\n");
+    }
+    
+    printf("; %d data words\n", memx);
+    for (i = 0; i < memx; i++)
+    {
+        name = labelName(i, FALSE);
+        printf("%5d %-9s dw   %d", i, name ? name : "", initial[i]);
+        if (isprint(initial[i]))
+            printf(" '%c'", initial[i]);
+        else if (initial[i] == '\n')
+            printf(" '\\n'");
+        printf("\n");
+    }
+}
+//-----------------------------------------
+// --profile: the statement of each instruction from name.map, or
+// failing that the line the decoder recorded, with no column
+void readMap(char *name)
+{
+    FILE *f;
+    char fileName[MAX];
+    int i, line, column;
+    
+    for (i = 0; i <= codex; i++)
+    {
+        mapLine[i] = code[i].line;
+        mapColumn[i] = 0;
+    }
+    strcpy(fileName, name);
+    strcat(fileName, ".map");
+    f = fopen(fileName, "r");
+    if (!f)
+        return;
+    while (fgets(inputLine, sizeof(inputLine), f))
+        if (sscanf(inputLine, "%d %d %d", &i, &line, &column) == 3 &&
+            i >= 0 && i < codex)
+        {
+            mapLine[i] = line;
+            mapColumn[i] = column;
+        }
+    fclose(f);
+}
+//-----------------------------------------
+// qsort order of instructions by statement
+int byStatement(const void *a, const void *b)
+{
+    int x = *(int *)a, y = *(int *)b;
+    
+    if (mapLine[x] != mapLine[y])
+        return mapLine[x] - mapLine[y];
+    if (mapColumn[x] != mapColumn[y])
+        return mapColumn[x] - mapColumn[y];
+    return x - y;
+}
+//-----------------------------------------
+int sameStatement(int x, int y)
+{
+    return mapLine[x] == mapLine[y] && mapColumn[x] == mapColumn[y];
+}
+//-----------------------------------------
+// --profile: the statements that ran the most instructions, on
+// stderr.  Instructions of a statement are grouped by sorting on
+// line and column; each group is then reduced in place to its
+// first instruction, with the group total in hits.
+void profileReport(long long count)
+{
+    int i, k, groups = 0, best;
+    long long total;
+    
+    for (i = 0; i <= codex; i++)
+        order[i] = i;
+    qsort(order, codex + 1, sizeof(order[0]), byStatement);
+    for (i = 0; i <= codex; i = k)
+    {
+        total = 0;
+        for (k = i; k <= codex && sameStatement(order[i], order[k]); k++)
+            total += hits[order[k]];
+        hits[order[i]] = total;
+        order[groups++] = order[i];
+    }
+    
+    fprintf(stderr, "profile: %lld instructions executed\n", count);
+    fprintf(stderr, "%6s %6s %14s %7s\n", "line", "column",
+            "instructions", "percent");
+    for (k = 0; k < HOTCOUNT && k < groups; k++)
+    {
+        best = k;
+        for (i = k + 1; i < groups; i++)
+            if (hits[order[i]] > hits[order[best]])
+                best = i;
+        i = order[best];
+        order[best] = order[k];
+        order[k] = i;
+        if (!hits[i])
+            break;
+        fprintf(stderr, "%6d %6d %14lld %6.1f%%\n", mapLine[i],
+                mapColumn[i], hits[i], 100.0 * hits[i] / count);
+    }
+}
+//-----------------------------------------
+// run the decoded program once and return the number of
+// instructions executed.  Values on the stack and in memory are
+// kept wrapped to 16 bits.
+long long execute(void)
+{
+    static void *handler[OPCOUNT] =
+    {
+        &&p, &&pc, &&pwc, &&awc, &&stav, &&add, &&sub, &&mult, &&div,
+        &&dout, &&aout, &&sout, &&ja, &&jz, &&jnz, &&jn, &&jp, &&jzop,
+        &&jzon, &&halt
+    };
+    INSTR *ip;
+    int *sp = stack, a, i;
+    long long count = 0;
+    
+    // --profile puts a counting handler in front of each one
+    for (i = 0; i <= codex; i++)
+        code[i].handler = profile ? &&counted : handler[code[i].op];
+    memcpy(mem, initial, sizeof(mem));
+    
+    // each handler does its work and goes on to the next
+#define NEXT { count++; ip++; goto *ip -> handler; }
+#define JUMP { count++; ip = code + ip -> operand; goto *ip -> handler; }
+#define BRANCH(test) { a = *--sp; if (test) JUMP; NEXT; }
+    
+    ip = code;
+    goto *ip -> handler;
+    
+counted:
+        hits[ip - code]++;
+        goto *handler[ip -> op];
+p:      *sp++ = mem[ip -> operand & (MEMSIZE - 1)];   NEXT;
+pc:
+pwc:    *sp++ = ip -> operand;                        NEXT;
+awc:    sp[-1] = WRAP(sp[-1] + ip -> operand);        NEXT;
+stav:   sp -= 2;
+        mem[sp[0] & (MEMSIZE - 1)] = sp[1];           NEXT;
+add:    sp--; sp[-1] = WRAP(sp[-1] + sp[0]);          NEXT;
+sub:    sp--; sp[-1] = WRAP(sp[-1] - sp[0]);          NEXT;
+mult:   sp--; sp[-1] = WRAP(sp[-1] * sp[0]);          NEXT;
+div:    sp--;
+        if (sp[0] == 0)
+        {
+            fflush(stdout);
+            printf("\nRuntime error: division by zero");
+            if (ip -> line)
+                printf(" on line %d", ip -> line);
+            printf("\n");
+            abend();
+        }
+        sp[-1] = WRAP(sp[-1] / sp[0]);                NEXT;
+dout:   a = *--sp;
+        if (!quiet)
+            printf("%d", a);
+        NEXT;
+aout:   a = *--sp;
+        if (!quiet)
+            putchar(a);
+        NEXT;
+sout:   a = *--sp;
+        for (i = a & (MEMSIZE - 1); !quiet && mem[i]; i = (i + 1) &
+             (MEMSIZE - 1))
+            putchar(mem[i]);
+        NEXT;
+ja:     JUMP;
+jz:     BRANCH(a == 0);
+jnz:    BRANCH(a != 0);
+jn:     BRANCH(a < 0);
+jp:     BRANCH(a > 0);
+jzop:   BRANCH(a >= 0);
+jzon:   BRANCH(a <= 0);
+halt:   count++;
+        return count;
+}
+//-----------------------------------------
+int main(int argc, char *argv[])
+{
+    int argx, run;
+    long long count = 0;
+    double seconds;
+    clock_t start;
+    
+    if (argc < 2)
+    {
+        printf("Incorrect number of command line args\n");
+        exit(1);
+    }
+    
+    // options precede the file name
+    for (argx = 1; argx < argc - 1; argx++)
+    {
+        if (!strcmp(argv[argx], "--stats"))
+            stats = TRUE;
+        else if (!strcmp(argv[argx], "--object"))
+            object = TRUE;
+        else if (!strcmp(argv[argx], "--disassemble"))
+            disassemble = TRUE;
+        else if (!strcmp(argv[argx], "--profile"))
+            profile = TRUE;
+        else if (!strncmp(argv[argx], "--repeat=", 9))
+        {
+            repeat = atoi(argv[argx] + 9);
+            if (repeat < 1)
+            {
+                printf("--repeat must be at least 1\n");
+                exit(1);
+            }
+        }
+        else
+        {
+            printf("Unknown option %s\n", argv[argx]);
+            exit(1);
+        }
+    }
+    
+    strcpy(inFileName, argv[argc - 1]);
+    strcat(inFileName, object ? ".ho" : ".a");  // append extension
+    inFile = fopen(inFileName, object ? "rb" : "r");
+    if (!inFile)
+    {
+        printf("Error: Cannot open %s\n", inFileName);
+        exit(1);
+    }
+    
+    start = clock();
+    if (object)
+        load();
+    else
+        decode();
+    fclose(inFile);
+    inFile = NULL;
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    if (stats)
+        fprintf(stderr, "%s %d instructions, %d data words in "
+                "%.3f s\n", object ? "loaded" : "decoded", codex, memx,
+                seconds);
+    
+    if (disassemble)
+    {
+        listProgram();
+        return 0;
+    }
+    
+    // only the first run prints
+    start = clock();
+    for (run = 0; run < repeat; run++)
+    {
+        count += execute();
+        quiet = TRUE;
+    }
+    fflush(stdout);
+    seconds = (double)(clock() - start) / CLOCKS_PER_SEC;
+    
+    if (stats)
+    {
+        fprintf(stderr, "%lld instructions executed in %.3f s", count,
+                seconds);
+        if (seconds > 0)
+            fprintf(stderr, ": %.0f instructions per second",
+                    count / seconds);
+        fprintf(stderr, "\n");
+    }
+    if (profile)
+    {
+        readMap(argv[argc - 1]);
+        profileReport(count);
+    }
+    return 0;
+}
@@ -15,6 +15,12 @@
 // Sizes for arrays
 #define MAX 180            // size of string arrays
 #define SYMTABSIZE 1000    // symbol table size
+#define MAXHOIST 100       // hoisted expressions per loop
+#define MAXTRIP 65536      // longest loop whose trip count is found
+#define MAXCOUNTERS 1000   // statements counted by --instrument
+#define HOTSHARE 10        // percent of all counts that makes a loop hot
+#define COLDSHARE 1        // percent below which a loop is cold
+#define HOTBUDGET 4        // times unrollBudget for a hot loop
 
 #define END 0
 #define PRINTLN 1
@@ -33,6 +39,12 @@
 #define RIGHTBRACKET 14
 #define DIVIDE 15
 #define WHILE 16
+#define EQUAL 17
+#define NOTEQUAL 18
+#define LESS 19
+#define LESSEQUAL 20
+#define GREATER 21
+#define GREATEREQUAL 22
 
 time_t timer;    // for asctime
 
@@ -40,14 +52,18 @@ time_t timer;    // for asctime
 // Function definition or prototype must
 // precede function call so compiler can
 // check for correct type, number of args
-void expr(void);
+struct nodetype *expr(void);
+struct nodetype *reassociate(struct nodetype *n);
+void genExpr(struct nodetype *n);
+
+void statement(void);
 
 void statementList(void);
 
 // Global Variables
 
 // tokenImage used in error messages.  See consume function.
-char *tokenImage[16] =
+char *tokenImage[23] =
 {
     "<END>",
     "\"println\"",
@@ -64,9 +80,14 @@ char *tokenImage[16] =
      "\"print\"",
      "\"{\"",
       "\"}\"",
-    "\"/\""
-    "\"while\""
-    
+    "\"/\"",
+    "\"while\"",
+    "\"==\"",
+    "\"!=\"",
+    "\"<\"",
+    "\"<=\"",
+    "\">\"",
+    "\">=\""
 };
 
 char inFileName[MAX], outFileName[MAX], inputLine[MAX];
@@ -75,6 +96,41 @@ int debug = FALSE;
 char *symbol[SYMTABSIZE];     // symbol table
 int symbolx;                  // index into symbol table
 
+// value[i] is the value of symbol[i] when known[i] is TRUE.  Values
+// are followed through straight-line code so that the trip count
+// of a loop like i = 0; while (i < 10) ... can be found.
+int known[SYMTABSIZE];
+int value[SYMTABSIZE];
+
+int unrollBudget = 100;       // instructions an unrolled body may have
+
+// --instrument: every assignment, print, and while counts its runs
+// in a pair of words, @cN and its carry @kN, for the statement at
+// countLine[N], countColumn[N].  Unrolled copies of a statement
+// share its counter.  At the end the program prints
+//     @count line column high low
+// for each, the count being high * 65536 + low (low is printed as
+// a signed word).  --profile-use=file reads these lines back.
+int instrument = FALSE;
+int countLine[MAXCOUNTERS], countColumn[MAXCOUNTERS];
+int counterx;
+
+// --profile-use: the counts read, and their total
+int profileUse = FALSE;
+int profLine[MAXCOUNTERS], profColumn[MAXCOUNTERS];
+double profCount[MAXCOUNTERS];
+int profx;
+double profTotal;
+
+// Coalesced output.  The text of a print or println of a constant
+// is added to outText.  A run of such text is printed by one sout
+// before dynamic output, code that could stop the program (a
+// division), a label or jump, or the end of the program, so a
+// run never crosses a loop boundary.
+char outText[MAX + 20];
+char *stringText[SYMTABSIZE]; // @str dw strings, emitted by endCode
+int stringCount;
+
 //create new type named TOKEN
 typedef struct tokentype
 {
@@ -84,6 +140,38 @@ typedef struct tokentype
     struct tokentype *next;
 } TOKEN;
 
+// L9 expressions are parsed into trees so that a while condition
+// can be emitted after the loop body (see whileStatement)
+typedef struct nodetype
+{
+    int kind;           // UNSIGNED, ID, or operator token kind
+    char *image;        // image of literal or identifier
+    struct nodetype *left, *right;
+} NODE;
+
+// Loop-invariant code motion.  Before a while body is compiled,
+// its tokens are scanned for the variables it assigns.  An
+// expression in the loop that reads only constants and other
+// variables is computed once, into an @h temp, by a preheader
+// ahead of the loop.  Division is never hoisted, since the loop
+// might not execute it at all.
+typedef struct looptype
+{
+    int line;                   // line of the while
+    char *written[SYMTABSIZE];  // variables the loop assigns
+    int writtenCount;
+    NODE *hoisted[MAXHOIST];    // expressions the preheader computes
+    char *hoistName[MAXHOIST];  // and the temps that hold them
+    int hoistCount;
+    int operations;             // operators in hoisted expressions
+    struct looptype *outer;
+} LOOP;
+
+LOOP *loop;                 // innermost loop being compiled
+int repeating = FALSE;      // compiling a body again: no loop reports
+
+int isWritten(LOOP *l, char *s);
+
 
 FILE *inFile, *outFile;     // file pointers
 
@@ -132,6 +220,17 @@ void enter(char *s)
         }
 }
 //-----------------------------------------
+// index of s in the symbol table, or -1
+int lookup(char *s)
+{
+    int i;
+    
+    for (i = 0; i < symbolx; i++)
+        if (!strcmp(s, symbol[i]))
+            return i;
+    return -1;
+}
+//-----------------------------------------
 void getNextChar(void)
 {
     if (currentChar == END)
@@ -237,7 +336,7 @@ TOKEN *getNextToken(void)
                 else if (!strcmp(t -> image, "print"))
                     t -> kind = PRINT;
 
-                else if (!strcmp(t -> image, "white")) 
+                else if (!strcmp(t -> image, "while"))
                     t -> kind = WHILE;
             
                 
@@ -247,10 +346,35 @@ TOKEN *getNextToken(void)
     
             else  // process single-character token
             {
+                // relational operators may be two characters long;
+                // inputLine[currentColumnNumber] is the char after currentChar
+                int secondChar = inputLine[currentColumnNumber];
+
                 switch(currentChar)
                 {
                     case '=':
-                        t -> kind = ASSIGN;
+                        if (secondChar == '=')
+                            t -> kind = EQUAL;
+                        else
+                            t -> kind = ASSIGN;
+                        break;
+                    case '!':
+                        if (secondChar == '=')
+                            t -> kind = NOTEQUAL;
+                        else
+                            t -> kind = ERROR;
+                        break;
+                    case '<':
+                        if (secondChar == '=')
+                            t -> kind = LESSEQUAL;
+                        else
+                            t -> kind = LESS;
+                        break;
+                    case '>':
+                        if (secondChar == '=')
+                            t -> kind = GREATEREQUAL;
+                        else
+                            t -> kind = GREATER;
                         break;
                     case ';':
                         t -> kind = SEMICOLON;
@@ -290,10 +414,18 @@ TOKEN *getNextToken(void)
                 }
                 
                 // save currentChar as string in image field
-                t -> image = (char *)malloc(2);  // get space
+                t -> image = (char *)malloc(3);  // get space
                 (t -> image)[0] = currentChar;   // move in string
                 (t -> image)[1] = '\0';
                 
+                // two-char operator: append second char and skip it
+                if (t -> kind >= EQUAL && t -> kind <= GREATEREQUAL &&
+                    secondChar == '=')
+                {
+                    (t -> image)[1] = '=';
+                    (t -> image)[2] = '\0';
+                    getNextChar();
+                }
                 
                 // save end-of-token position
                 t -> endLine = currentLineNumber;
@@ -387,6 +519,97 @@ TOKEN *getToken(int i)
     return t;
 }
 //-----------------------------------------
+// the token after t, read ahead if need be
+TOKEN *nextToken(TOKEN *t)
+{
+    if (!t -> next)
+        t -> next = getNextToken();
+    return t -> next;
+}
+//-----------------------------------------
+// scan, without parsing, the statement that starts with token t and
+// add each variable it assigns to loop l.  Returns the token after
+// the statement.  Errors are left for the parser to report.
+TOKEN *scanStatement(TOKEN *t, LOOP *l)
+{
+    int depth;
+    
+    switch(t -> kind)
+    {
+        case LEFTBRACKET:
+            t = nextToken(t);
+            while (t -> kind != RIGHTBRACKET && t -> kind != END)
+                t = scanStatement(t, l);
+            break;
+            
+        case WHILE:
+            t = nextToken(nextToken(t));    // skip "while" "("
+            for (depth = 1; depth && t -> kind != END; t = nextToken(t))
+                if (t -> kind == LEFTPAREN)
+                    depth++;
+                else if (t -> kind == RIGHTPAREN)
+                    depth--;
+            return scanStatement(t, l);
+            
+        default:
+            if (t -> kind == ID && nextToken(t) -> kind == ASSIGN &&
+                !isWritten(l, t -> image) && l -> writtenCount < SYMTABSIZE)
+                l -> written[l -> writtenCount++] = t -> image;
+            while (t -> kind != SEMICOLON && t -> kind != RIGHTBRACKET &&
+                   t -> kind != END)
+                t = nextToken(t);
+            if (t -> kind != SEMICOLON)
+                return t;
+    }
+    return t -> kind == END ? t : nextToken(t);
+}
+//-----------------------------------------
+// count in *count the assignments to v in the statement at token t,
+// and put in *step the c of a v = v + c or v = v - c.  Only that
+// form, outside any nested loop, counts once; any other assignment
+// to v counts twice.  Returns the token after the statement.
+TOKEN *findStep(TOKEN *t, char *v, int *step, int *count)
+{
+    static LOOP scratch;
+    TOKEN *a[6];
+    int i;
+    
+    if (t -> kind == LEFTBRACKET)
+    {
+        t = nextToken(t);
+        while (t -> kind != RIGHTBRACKET && t -> kind != END)
+            t = findStep(t, v, step, count);
+        return t -> kind == END ? t : nextToken(t);
+    }
+    
+    scratch.writtenCount = 0;
+    if (t -> kind == WHILE)
+    {
+        t = scanStatement(t, &scratch);
+        if (isWritten(&scratch, v))
+            *count += 2;
+        return t;
+    }
+    
+    for (a[0] = t, i = 1; i < 6; i++)
+        a[i] = nextToken(a[i - 1]);
+    if (t -> kind == ID && !strcmp(t -> image, v) && a[1] -> kind == ASSIGN)
+    {
+        if (a[2] -> kind == ID && !strcmp(a[2] -> image, v) &&
+            (a[3] -> kind == PLUS || a[3] -> kind == MINUS) &&
+            a[4] -> kind == UNSIGNED && a[5] -> kind == SEMICOLON)
+        {
+            *step = atoi(a[4] -> image);
+            if (a[3] -> kind == MINUS)
+                *step = -*step;
+            (*count)++;
+        }
+        else
+            *count += 2;
+    }
+    return scanStatement(t, &scratch);
+}
+//-----------------------------------------
 // emit one-operand instruction
 void emitInstruction1(char *op)
 {
@@ -411,20 +634,569 @@ void emitdw(char *label, char *value)
             "%-9s dw        %s\n", temp, value);
 }
 //-----------------------------------------
+void flushOutput(void);
+void dumpCounts(void);
+
 void endCode(void)
 {
     int i;
+    char label[20], value[2 * MAX + 20], *p, *q;
+    
+    if (instrument)
+        dumpCounts();
+    flushOutput();
     emitInstruction1("\n          halt\n");
     
     // emit dw for each symbol in the symbol table
     for (i=0; i < symbolx; i++)
         emitdw(symbol[i], "0");
+    
+    // and the two words of each counter
+    for (i = 0; i < counterx; i++)
+    {
+        sprintf(label, "@c%d", i);
+        emitdw(label, "0");
+        sprintf(label, "@k%d", i);
+        emitdw(label, "0");
+    }
+    
+    // and for each string, with newlines written \n
+    for (i = 0; i < stringCount; i++)
+    {
+        sprintf(label, "@str%d", i);
+        q = value;
+        *q++ = '"';
+        for (p = stringText[i]; *p; p++)
+            if (*p == '\n')
+            {
+                *q++ = '\\';
+                *q++ = 'n';
+            }
+            else
+                *q++ = *p;
+        *q++ = '"';
+        *q = '\0';
+        emitdw(label, value);
+    }
+}
+//-----------------------------------------
+// print the pending constant text with one sout
+void flushOutput(void)
+{
+    char label[20];
+    
+    if (!outText[0])
+        return;
+    if (stringCount >= SYMTABSIZE)
+    {
+        printf("System error: string table overflow\n");
+        abend();
+    }
+    sprintf(label, "@str%d", stringCount);
+    stringText[stringCount++] = strdup(outText);
+    emitInstruction2("pc", label);
+    emitInstruction1("sout");
+    outText[0] = '\0';
+}
+//-----------------------------------------
+// add text to the pending constant output
+void addOutput(char *text)
+{
+    if (strlen(outText) + strlen(text) > MAX)
+        flushOutput();
+    strcat(outText, text);
+}
+//-----------------------------------------
+// emit a label on its own line
+void emitLabel(char *label)
+{
+    flushOutput();
+    fprintf(outFile, "%s:\n", label);
+}
+//-----------------------------------------
+// returns a unique label for generated jump targets
+char *getLabel(void)
+{
+    static int count = 0;
+    char lbuf[20];
+    sprintf(lbuf, "@L%d", count++);
+    return strdup(lbuf);
+}
+//-----------------------------------------
+// --instrument: index of the counter of the statement at t
+int counter(TOKEN *t)
+{
+    int i;
+    
+    for (i = 0; i < counterx; i++)
+        if (countLine[i] == t -> beginLine &&
+            countColumn[i] == t -> beginColumn)
+            return i;
+    if (counterx >= MAXCOUNTERS)
+    {
+        printf("System error: too many statements to count\n");
+        abend();
+    }
+    countLine[counterx] = t -> beginLine;
+    countColumn[counterx] = t -> beginColumn;
+    return counterx++;
+}
+//-----------------------------------------
+// --instrument: count a run of the statement at t.  The carry word
+// is incremented when the low word wraps to 0.  Pending output is
+// printed first, since it must not land in the skipped carry code.
+void genCount(TOKEN *t)
+{
+    char low[20], high[20], *skip;
+    int i;
+    
+    flushOutput();
+    i = counter(t);
+    sprintf(low, "@c%d", i);
+    sprintf(high, "@k%d", i);
+    skip = getLabel();
+    emitInstruction2("pc", low);
+    emitInstruction2("p", low);
+    emitInstruction2("awc", "1");
+    emitInstruction1("stav");
+    emitInstruction2("p", low);
+    emitInstruction2("jnz", skip);
+    emitInstruction2("pc", high);
+    emitInstruction2("p", high);
+    emitInstruction2("awc", "1");
+    emitInstruction1("stav");
+    emitLabel(skip);
+}
+//-----------------------------------------
+// --instrument: print every counter, ahead of the halt
+void dumpCounts(void)
+{
+    char text[60], label[20];
+    int i;
+    
+    addOutput("\n");
+    for (i = 0; i < counterx; i++)
+    {
+        sprintf(text, "@count %d %d ", countLine[i], countColumn[i]);
+        addOutput(text);
+        flushOutput();
+        sprintf(label, "@k%d", i);
+        emitInstruction2("p", label);
+        emitInstruction1("dout");
+        addOutput(" ");
+        flushOutput();
+        sprintf(label, "@c%d", i);
+        emitInstruction2("p", label);
+        emitInstruction1("dout");
+        emitInstruction2("pc", "'\\n'");
+        emitInstruction1("aout");
+    }
+}
+//-----------------------------------------
+// --profile-use: read the @count lines of the output of a program
+// compiled with --instrument; other lines are ignored
+void readProfile(char *fileName)
+{
+    FILE *f;
+    char line[MAX];
+    int l, c, high, low;
+    
+    f = fopen(fileName, "r");
+    if (!f)
+    {
+        printf("Error: Cannot open %s\n", fileName);
+        exit(1);
+    }
+    while (fgets(line, sizeof(line), f))
+        if (sscanf(line, "@count %d %d %d %d", &l, &c, &high, &low) == 4
+            && profx < MAXCOUNTERS)
+        {
+            profLine[profx] = l;
+            profColumn[profx] = c;
+            profCount[profx] = high * 65536.0 + (low & 0xffff);
+            profTotal += profCount[profx++];
+        }
+    fclose(f);
+    profileUse = TRUE;
+}
+//-----------------------------------------
+// --profile-use: runs of the statement at t, or -1 if not profiled.
+// A compound statement has no counter of its own; its first
+// statement stands for it.
+double profiled(TOKEN *t)
+{
+    int i;
+    
+    while (t -> kind == LEFTBRACKET)
+        t = nextToken(t);
+    for (i = 0; i < profx; i++)
+        if (profLine[i] == t -> beginLine &&
+            profColumn[i] == t -> beginColumn)
+            return profCount[i];
+    return -1;
+}
+//-----------------------------------------
+NODE *makeNode(int kind, char *image, NODE *left, NODE *right)
+{
+    NODE *n;
+    n = (NODE *)malloc(sizeof(NODE));
+    n -> kind = kind;
+    n -> image = image;
+    n -> left = left;
+    n -> right = right;
+    return n;
+}
+//-----------------------------------------
+// emit stack code for tree n
+void genTree(NODE *n)
+{
+    switch(n -> kind)
+    {
+        case UNSIGNED:
+            emitInstruction2("pwc", n -> image);
+            break;
+        case ID:
+            emitInstruction2("p", n -> image);
+            break;
+        case PLUS:
+            genTree(n -> left);
+            genTree(n -> right);
+            emitInstruction1("add");
+            break;
+        case MINUS:
+            genTree(n -> left);
+            genTree(n -> right);
+            emitInstruction1("sub");
+            break;
+        case TIMES:
+            genTree(n -> left);
+            genTree(n -> right);
+            emitInstruction1("mult");
+            break;
+        case DIVIDE:
+            genTree(n -> left);
+            genTree(n -> right);
+            emitInstruction1("div");
+            break;
+    }
+}
+//-----------------------------------------
+// TRUE if loop l assigns variable s
+int isWritten(LOOP *l, char *s)
+{
+    int i;
+    
+    for (i = 0; i < l -> writtenCount; i++)
+        if (!strcmp(s, l -> written[i]))
+            return TRUE;
+    return FALSE;
+}
+//-----------------------------------------
+// TRUE if n has the same value on every iteration of loop l
+int invariant(LOOP *l, NODE *n)
+{
+    if (n -> kind == UNSIGNED)
+        return TRUE;
+    if (n -> kind == ID)
+        return !isWritten(l, n -> image);
+    return n -> kind != DIVIDE && invariant(l, n -> left) &&
+           invariant(l, n -> right);
+}
+//-----------------------------------------
+// TRUE if trees a and b compute the same expression
+int sameTree(NODE *a, NODE *b)
+{
+    if (!a || !b)
+        return a == b;
+    return a -> kind == b -> kind && !strcmp(a -> image, b -> image) &&
+           sameTree(a -> left, b -> left) && sameTree(a -> right, b -> right);
+}
+//-----------------------------------------
+// number of operators in tree n
+int operations(NODE *n)
+{
+    if (!n -> left)
+        return 0;
+    return 1 + operations(n -> left) + operations(n -> right);
+}
+//-----------------------------------------
+// replace each largest invariant subtree of n by the temp that the
+// preheader computes it into.  The subtree goes to the outermost
+// loop it is invariant in, once however often it appears there.
+NODE *hoist(NODE *n)
+{
+    LOOP *l;
+    int i;
+    char temp[20];
+    static int count = 0;
+    
+    if (!n -> left)
+        return n;
+    if (!invariant(loop, n))
+    {
+        n -> left = hoist(n -> left);
+        n -> right = hoist(n -> right);
+        return n;
+    }
+    
+    for (l = loop; l -> outer && invariant(l -> outer, n); l = l -> outer)
+        ;
+    for (i = 0; i < l -> hoistCount; i++)
+        if (sameTree(n, l -> hoisted[i]))
+            break;
+    if (i == l -> hoistCount)
+    {
+        if (l -> hoistCount >= MAXHOIST)
+            return n;
+        sprintf(temp, "@h%d", count++);
+        l -> hoistName[i] = strdup(temp);
+        l -> hoisted[l -> hoistCount++] = n;
+        l -> operations += operations(n);
+        enter(l -> hoistName[i]);
+    }
+    return makeNode(ID, l -> hoistName[i], NULL, NULL);
+}
+//-----------------------------------------
+// wrap an int to the 16-bit two's complement range of an H1 word
+int wrap16(int v)
+{
+    return ((v + 32768) & 0xffff) - 32768;
+}
+//-----------------------------------------
+// TRUE if the value of n is known at compile time, and then *v is
+// that value.  The variable named iv, if not NULL, has value ivValue.
+// A division is left to run time.
+int evaluate(NODE *n, char *iv, int ivValue, int *v)
+{
+    int i, l, r;
+    
+    switch(n -> kind)
+    {
+        case UNSIGNED:
+            *v = wrap16(atoi(n -> image));
+            return TRUE;
+        case ID:
+            if (iv && !strcmp(n -> image, iv))
+            {
+                *v = ivValue;
+                return TRUE;
+            }
+            i = lookup(n -> image);
+            if (i < 0 || !known[i])
+                return FALSE;
+            *v = value[i];
+            return TRUE;
+        case PLUS:
+        case MINUS:
+        case TIMES:
+            if (!evaluate(n -> left, iv, ivValue, &l) ||
+                !evaluate(n -> right, iv, ivValue, &r))
+                return FALSE;
+            if (n -> kind == PLUS)
+                *v = wrap16(l + r);
+            else if (n -> kind == MINUS)
+                *v = wrap16(l - r);
+            else
+                *v = wrap16(l * r);
+            return TRUE;
+    }
+    return FALSE;
+}
+//-----------------------------------------
+// record whether the value of variable s is known
+void setKnown(char *s, int isKnown, int v)
+{
+    int i;
+    
+    i = lookup(s);
+    if (i >= 0)
+    {
+        known[i] = isKnown;
+        value[i] = v;
+    }
+}
+//-----------------------------------------
+// forget the values of the variables loop l assigns
+void forget(LOOP *l)
+{
+    int i;
+    
+    for (i = 0; i < l -> writtenCount; i++)
+        setKnown(l -> written[i], FALSE, 0);
+}
+//-----------------------------------------
+// stack words needed to evaluate n, left operand first
+int need(NODE *n)
+{
+    int l, r;
+    
+    if (!n -> left)
+        return 1;
+    l = need(n -> left);
+    r = need(n -> right) + 1;
+    return l > r ? l : r;
+}
+//-----------------------------------------
+// TRUE if chain operand a goes before b: deepest first, but in a
+// loop the invariant operands come first so they form a subtree
+// that can be hoisted
+int before(NODE *a, NODE *b)
+{
+    if (loop && invariant(loop, a) != invariant(loop, b))
+        return invariant(loop, a);
+    return need(a) > need(b);
 }
 //-----------------------------------------
-void factor(void)
+// number of operands of the chain of + and - (or of *) at n
+int chainLength(NODE *n, int product)
+{
+    if (product ? n -> kind == TIMES :
+        n -> kind == PLUS || n -> kind == MINUS)
+        return chainLength(n -> left, product) +
+               chainLength(n -> right, product);
+    return 1;
+}
+//-----------------------------------------
+// collect the operands of the chain of + and - (or of *) at n.
+// sign[i] is -1 for an operand that is subtracted.
+void collect(NODE *n, int product, int s, NODE **opnd, int *sign,
+             int *count)
+{
+    if (product ? n -> kind == TIMES :
+        n -> kind == PLUS || n -> kind == MINUS)
+    {
+        collect(n -> left, product, s, opnd, sign, count);
+        collect(n -> right, product, n -> kind == MINUS ? -s : s,
+                opnd, sign, count);
+    }
+    else
+    {
+        opnd[*count] = reassociate(n);
+        sign[(*count)++] = s;
+    }
+}
+//-----------------------------------------
+// Reassociation.  A chain of + and - (or of *) is flattened and
+// its constants are folded into one operand, in 16 bits like H1,
+// so the value is unchanged.  The other operands go deepest
+// first: a left-deep chain then needs one word more than its
+// deepest operand, which is the least any order needs on a stack
+// machine.  The constant goes last, except in a loop, where it
+// joins the invariant operands.
+NODE *reassociate(NODE *n)
+{
+    NODE **opnd, *t;
+    int *sign, count = 0, product, c, v, i, j, inv;
+    char temp[MAX];
+    
+    if (!n -> left)
+        return n;
+    if (n -> kind == DIVIDE)
+    {
+        n -> left = reassociate(n -> left);
+        n -> right = reassociate(n -> right);
+        return n;
+    }
+    
+    // a chain can run over any number of lines, so the operand
+    // arrays are sized to it
+    product = n -> kind == TIMES;
+    i = chainLength(n, product);
+    opnd = (NODE **)malloc(i * sizeof(NODE *));
+    sign = (int *)malloc(i * sizeof(int));
+    collect(n, product, 1, opnd, sign, &count);
+    
+    c = product ? 1 : 0;
+    for (i = j = 0; i < count; i++)
+        if (opnd[i] -> kind == UNSIGNED)
+        {
+            v = wrap16(atoi(opnd[i] -> image));
+            c = wrap16(product ? c * v : c + sign[i] * v);
+        }
+        else
+        {
+            opnd[j] = opnd[i];
+            sign[j++] = sign[i];
+        }
+    count = j;
+    
+    // deepest first, keeping source order among equals
+    for (i = 1; i < count; i++)
+        for (j = i; j > 0 && before(opnd[j], opnd[j - 1]); j--)
+        {
+            t = opnd[j];
+            opnd[j] = opnd[j - 1];
+            opnd[j - 1] = t;
+            v = sign[j];
+            sign[j] = sign[j - 1];
+            sign[j - 1] = v;
+        }
+    
+    // a sum starts with an operand that is added, or else with the
+    // constant
+    for (i = 0; i < count && sign[i] < 0; i++)
+        ;
+    if (i < count)
+        for (; i > 0; i--)
+        {
+            t = opnd[i];
+            opnd[i] = opnd[i - 1];
+            opnd[i - 1] = t;
+            sign[i] = -1;
+            sign[i - 1] = 1;
+        }
+    
+    for (inv = 0; loop && inv < count && invariant(loop, opnd[inv]); inv++)
+        ;
+    
+    sprintf(temp, "%d", c);
+    if (count == 0 || sign[0] < 0)
+    {
+        n = makeNode(UNSIGNED, strdup(temp), NULL, NULL);
+        c = product ? 1 : 0;
+        i = 0;
+    }
+    else
+    {
+        n = opnd[0];
+        i = 1;
+    }
+    for (; i < count; i++)
+    {
+        if (i == inv && c != (product ? 1 : 0))
+        {
+            n = makeNode(product ? TIMES : PLUS, product ? "*" : "+", n,
+                         makeNode(UNSIGNED, strdup(temp), NULL, NULL));
+            c = product ? 1 : 0;
+        }
+        if (product)
+            n = makeNode(TIMES, "*", n, opnd[i]);
+        else
+            n = makeNode(sign[i] > 0 ? PLUS : MINUS, sign[i] > 0 ? "+" :
+                         "-", n, opnd[i]);
+    }
+    if (c != (product ? 1 : 0))
+        n = makeNode(product ? TIMES : PLUS, product ? "*" : "+", n,
+                     makeNode(UNSIGNED, strdup(temp), NULL, NULL));
+    free(opnd);
+    free(sign);
+    return n;
+}
+//-----------------------------------------
+// emit stack code that leaves the value of n on top of the stack
+void genExpr(NODE *n)
+{
+    n = reassociate(n);
+    if (loop)
+        n = hoist(n);
+    genTree(n);
+}
+//-----------------------------------------
+NODE *factor(void)
 {
     TOKEN *t;
     char temp[MAX];
+    NODE *n;
     
     printf("%s ", currentToken -> image);
     switch(currentToken -> kind)
@@ -432,104 +1204,101 @@ void factor(void)
         case UNSIGNED:
             t = currentToken;
             consume(UNSIGNED);
-            emitInstruction2("pwc", t -> image);
-            break;
+            return makeNode(UNSIGNED, t -> image, NULL, NULL);
         case PLUS:
             consume(PLUS);
             t = currentToken;
             consume(UNSIGNED);
-            emitInstruction2("pwc", t -> image);
-            break;
+            return makeNode(UNSIGNED, t -> image, NULL, NULL);
         case MINUS:
             consume(MINUS);
             t = currentToken;
             consume(UNSIGNED);
             strcpy(temp, "-");
             strcat(temp, t -> image);
-            emitInstruction2("pwc", temp);
-            break;
+            return makeNode(UNSIGNED, strdup(temp), NULL, NULL);
         case ID:
             t = currentToken;
             consume(ID);
             enter(t -> image);
-            emitInstruction2("p", t -> image);
-            break;
+            return makeNode(ID, t -> image, NULL, NULL);
         case LEFTPAREN:
             consume(LEFTPAREN);
-            expr();
+            n = expr();
             consume(RIGHTPAREN);
-            break;
+            return n;
         default:
             displayErrorLoc();
             printf("Scanning %s, expecting factor\n", currentToken ->
                    image);
             abend();
     }
+    return NULL;
 }
 //-----------------------------------------
-void factorList(void)
+NODE *factorList(NODE *left)
 {
     switch(currentToken -> kind)
     {
         case TIMES:
             consume(TIMES);
-            factor();
-            emitInstruction1("mult");
-            factorList();
-            break;
+            left = makeNode(TIMES, "*", left, factor());
+            return factorList(left);
             
         case DIVIDE:
             consume(DIVIDE);
-            factor();
-            emitInstruction1("div");
-            factorList();
-            break;
+            left = makeNode(DIVIDE, "/", left, factor());
+            return factorList(left);
             
         case PLUS:
         case MINUS: //adding MINUS, telling compiler to simply proceed if a MINUS token appears (lambda)
             
-            
+        case EQUAL:
+        case NOTEQUAL:
+        case LESS:
+        case LESSEQUAL:
+        case GREATER:
+        case GREATEREQUAL:
         case RIGHTPAREN:
         case SEMICOLON:
-            ;
-            break;
+            return left;
         default:
             displayErrorLoc();
             printf("Scanning %s, expecting op, \")\", or \";\"\n",
                    currentToken -> image);
             abend();
     }
+    return NULL;
 }
 //-----------------------------------------
-void term(void)
+NODE *term(void)
 {
-    factor();
-    factorList();
+    return factorList(factor());
 }
 //-----------------------------------------
-void termList(void)
+NODE *termList(NODE *left)
 {
     switch(currentToken -> kind)
     {
         case PLUS:
             consume(PLUS);
-            term();
-            emitInstruction1("add");
-            termList();
-            break;
+            left = makeNode(PLUS, "+", left, term());
+            return termList(left);
             
         case MINUS:
-            
             consume(MINUS);
-            term();
-            emitInstruction1("sub");
-            termList();
-            break;
+            left = makeNode(MINUS, "-", left, term());
+            return termList(left);
             
+        case EQUAL:
+        case NOTEQUAL:
+        case LESS:
+        case LESSEQUAL:
+        case GREATER:
+        case GREATEREQUAL:
         case RIGHTPAREN:
         case SEMICOLON:
-            ;
-            break;
+            return left;
         default:
             displayErrorLoc();
             printf(
@@ -537,24 +1306,180 @@ void termList(void)
                    currentToken -> image);
             abend();
     }
+    return NULL;
+}
+//-----------------------------------------
+NODE *expr(void)
+{
+    return termList(term());
+}
+//-----------------------------------------
+// condition -> expr [relop expr]
+// A bare expr is true when nonzero.  A comparison is returned as
+// a relop node so genBranch can fold it into a conditional jump.
+NODE *condition(void)
+{
+    NODE *left;
+    int kind;
+    
+    left = expr();
+    kind = currentToken -> kind;
+    if (kind >= EQUAL && kind <= GREATEREQUAL)
+    {
+        consume(kind);
+        return makeNode(kind, tokenImage[kind], left, expr());
+    }
+    return left;
+}
+//-----------------------------------------
+// TRUE if n folds to a constant, and then *c is its value
+int constant(NODE *n, int *c)
+{
+    n = reassociate(n);
+    if (n -> kind != UNSIGNED)
+        return FALSE;
+    *c = wrap16(atoi(n -> image));
+    return TRUE;
+}
+//-----------------------------------------
+// emit left - right, then the jump of comparison kind to label.
+// Comparing against 0 needs no subtract.  Otherwise left - right is
+// one chain, so x + 1 < y + 3 tests x - y - 2.
+void genDifference(NODE *left, NODE *right, int kind, char *label)
+{
+    char *jump[] = {"jz", "jnz", "jn", "jzon", "jp", "jzop"};
+    int c;
+    
+    if (!constant(right, &c) || c)
+        genExpr(makeNode(MINUS, "-", left, right));
+    else
+        genExpr(left);
+    emitInstruction2(jump[kind - EQUAL], label);
+}
+//-----------------------------------------
+// emit code that jumps to label if cond is true and falls
+// through otherwise.  H1 conditional jumps pop the top of the
+// stack and test it, so a comparison becomes left - right followed
+// by one jump; no 0/1 boolean is ever pushed.
+//
+// The 16-bit difference is exact for == and !=, but for <, <=, >
+// and >= it overflows when the operands are more than 32767 apart,
+// which needs opposite signs.  So the signs are tested first, and
+// the difference only when they match.  A constant is put on the
+// right, where its sign is known: x > 5 needs only the test of x,
+// x > 0 none.  A loop that goes on still takes one branch per test.
+void genBranch(NODE *cond, char *label)
+{
+    NODE *left = cond -> left, *right = cond -> right;
+    char *skip, *negative;
+    int kind = cond -> kind, less, c;
+    
+    if (kind < EQUAL || kind > GREATEREQUAL)
+    {
+        // not a comparison: branch if value is nonzero
+        genExpr(cond);
+        emitInstruction2("jnz", label);
+        return;
+    }
+    if (kind == EQUAL || kind == NOTEQUAL)
+    {
+        genDifference(left, right, kind, label);
+        return;
+    }
+    
+    // 5 < x is x > 5
+    if (constant(left, &c) && !constant(right, &c))
+    {
+        left = cond -> right;
+        right = cond -> left;
+        kind = kind <= LESSEQUAL ? kind + 2 : kind - 2;
+    }
+    if (constant(right, &c) && c == 0)
+    {
+        genDifference(left, right, kind, label);
+        return;
+    }
+    less = kind <= LESSEQUAL;
+    skip = getLabel();
+    
+    if (constant(right, &c))
+    {
+        // left < 0 < c means left is less; c < 0 <= left means left
+        // is greater
+        genExpr(left);
+        if (c > 0)
+            emitInstruction2("jn", less ? label : skip);
+        else
+            emitInstruction2("jzop", less ? skip : label);
+        genDifference(left, right, kind, label);
+    }
+    else
+    {
+        negative = getLabel();
+        genExpr(left);
+        emitInstruction2("jn", negative);
+        genExpr(right);
+        emitInstruction2("jn", less ? skip : label);
+        genDifference(left, right, kind, label);
+        emitInstruction2("ja", skip);
+        emitLabel(negative);
+        genExpr(right);
+        emitInstruction2("jzop", less ? label : skip);
+        genDifference(left, right, kind, label);
+    }
+    emitLabel(skip);
 }
 //-----------------------------------------
-void expr(void)
+// TRUE if tree n has a node of the given kind
+int contains(NODE *n, int kind)
 {
-    term();
-    termList();
+    if (!n)
+        return FALSE;
+    return n -> kind == kind || contains(n -> left, kind) ||
+           contains(n -> right, kind);
+}
+//-----------------------------------------
+// print n, followed by a newline if newline is TRUE.  A constant
+// is added to the pending output; anything else is printed by dout.
+void genOutput(NODE *n, int newline)
+{
+    char temp[20];
+    
+    n = reassociate(n);
+    if (n -> kind == UNSIGNED)
+    {
+        sprintf(temp, newline ? "%d\n" : "%d", wrap16(atoi(n -> image)));
+        addOutput(temp);
+        return;
+    }
+    
+    flushOutput();
+    genExpr(n);
+    emitInstruction1("dout");
+    if (newline)
+    {
+        emitInstruction2("pc", "'\\n'");
+        emitInstruction1("aout");
+    }
 }
 //-----------------------------------------
 void assignmentStatement(void)
 {
     TOKEN *t;
+    NODE *n;
+    int isKnown, v = 0;
     
     t = currentToken;
     consume(ID);
     enter(t -> image);
-    emitInstruction2("pc", t -> image);
     consume(ASSIGN);
-    expr();
+    n = expr();
+    isKnown = evaluate(n, NULL, 0, &v);
+    setKnown(t -> image, isKnown, v);
+    if (contains(n, DIVIDE))
+        flushOutput();
+    emitInstruction2("pc", t -> image);
+    genExpr(n);
     emitInstruction1("stav");
     consume(SEMICOLON);
 }
@@ -563,10 +1488,7 @@ void printlnStatement(void)
 {
     consume(PRINTLN);
     consume(LEFTPAREN);
-    expr();
-    emitInstruction1("dout");
-    emitInstruction2("pc", "'\\n'");
-    emitInstruction1("aout");
+    genOutput(expr(), TRUE);
     consume(RIGHTPAREN);
     consume(SEMICOLON);
 }
@@ -574,8 +1496,7 @@ void printlnStatement(void)
 void printStatement(void) {
     consume(PRINT);
     consume(LEFTPAREN);
-    expr();
-    emitInstruction1("dout");
+    genOutput(expr(), FALSE);
 
     consume(RIGHTPAREN);
     consume(SEMICOLON);
@@ -591,54 +1512,279 @@ void compoundStatement(void) {
     
     
 }
-
-void whileStatemenet(void) {
+//-----------------------------------------
+// TRUE if the outcome of cond is known at compile time when variable
+// iv has the value ivValue, and then *taken is that outcome.  The
+// operands are 16-bit values, so they are compared as they are; a
+// bare expression is compared with 0.
+int decide(NODE *cond, char *iv, int ivValue, int *taken)
+{
+    int l, r = 0;
     
-    consume(WHILE);
-    cosume(LEFTPAREN);
-    do {
-        expr();
+    if (cond -> kind >= EQUAL && cond -> kind <= GREATEREQUAL)
+    {
+        if (!evaluate(cond -> left, iv, ivValue, &l) ||
+            !evaluate(cond -> right, iv, ivValue, &r))
+            return FALSE;
     }
-        while(currentToken -> kind != SEMICOLON);
-
+    else if (!evaluate(cond, iv, ivValue, &l))
+        return FALSE;
+    
+    switch(cond -> kind)
+    {
+        case EQUAL:        *taken = l == r; break;
+        case LESS:         *taken = l < r;  break;
+        case LESSEQUAL:    *taken = l <= r; break;
+        case GREATER:      *taken = l > r;  break;
+        case GREATEREQUAL: *taken = l >= r; break;
+        default:           *taken = l != r; break;
+    }
+    return TRUE;
 }
-    /*
-    //switch statement to handle both constant and expression conditions
-    switch (currentToken -> kind) {
-        case ID:
-            int i = 1;
-            do{ 
-
-                TOKEN *aToken = getToken(i);
-                int value = atoi(aToken -> iamge); //returns integer value of char image
-                amt = amt + value; //add to exmpresion amt
-                i++;
-
-
-              //  assignmentStatement();
-
-
-        }   while(currentToken -> kind != SEMICOLON);
-
-        for (int i = 0; i < amt; i++) {
-            expr();
+//-----------------------------------------
+// put in *v the one variable of n that loop l writes.  FALSE if n
+// reads more than one.
+int inductionVariable(NODE *n, LOOP *l, char **v)
+{
+    if (!n)
+        return TRUE;
+    if (n -> kind == ID && isWritten(l, n -> image))
+    {
+        if (*v && strcmp(*v, n -> image))
+            return FALSE;
+        *v = n -> image;
+    }
+    return inductionVariable(n -> left, l, v) &&
+           inductionVariable(n -> right, l, v);
+}
+//-----------------------------------------
+// Trip-count analysis.  Returns how many times loop l with
+// condition cond and the body at token body runs, or -1 if that is
+// not known at compile time.  The condition must read one variable
+// *iv whose value here is known and which the body changes only by
+// one iv = iv + c or iv = iv - c per iteration; the rest of the
+// condition must be known too.  The loop is then run on its
+// condition alone, and *final is the value iv is left with.
+int tripCount(NODE *cond, TOKEN *body, LOOP *l, char **iv, int *final)
+{
+    int step = 0, count = 0, i, x, taken, trip;
+    
+    *iv = NULL;
+    if (!inductionVariable(cond, l, iv) || !*iv)
+        return -1;
+    findStep(body, *iv, &step, &count);
+    i = lookup(*iv);
+    if (count != 1 || !step || i < 0 || !known[i])
+        return -1;
+    
+    x = value[i];
+    for (trip = 0; trip < MAXTRIP; trip++)
+    {
+        if (!decide(cond, *iv, x, &taken))
+            return -1;
+        if (!taken)
+        {
+            *final = x;
+            return trip;
         }
-        statement();
-
-        break;
+        x = wrap16(x + step);
     }
-
-
-
-
-    */
-
- 
-
+    return -1;
+}
+//-----------------------------------------
+// number of instructions in assembler text
+int instructions(char *text)
+{
+    int count = 0;
+    char *p;
+    
+    for (p = text; *p; p++)
+        if ((p == text || p[-1] == '\n') && *p == ' ' &&
+            strspn(p, " ") < strcspn(p, "\n"))
+            count++;
+    return count;
+}
+//-----------------------------------------
+// open an output stream to memory
+FILE *openBuffer(char **text, size_t *size)
+{
+    FILE *f;
+    
+    f = open_memstream(text, size);
+    if (!f)
+    {
+        printf("System error: cannot buffer loop\n");
+        abend();
+    }
+    return f;
+}
+//-----------------------------------------
+// compile one more copy of the loop body that starts at token body
+void copyBody(TOKEN *body, LOOP *l)
+{
+    forget(l);
+    currentToken = body;
+    statement();
+}
+//-----------------------------------------
+// whileStatement -> "while" "(" condition ")" statement
+//
+// The loop is laid out rotated, with the test at the bottom:
+//
+//          ja        @test
+// @body:
+//          <statement>
+// @test:
+//          <condition>  jump to @body if true
+//
+// so each iteration executes exactly one taken branch.  The loop
+// is compiled into memory so that the expressions hoisted from it
+// can be computed by a preheader placed ahead of the ja.  Source
+// lines read by the scan of the body are echoed ahead of the loop.
+//
+// When the trip count is known, the ja is left out, and the body is
+// unrolled by compiling its tokens again.  If trip copies fit in
+// unrollBudget instructions, the loop becomes those copies.  If not,
+// @body holds as many copies as fit, and the trip % copies left over
+// run once each ahead of the loop.
+void whileStatement(void)
+{
+    NODE *cond;
+    char *bodyLabel, *testLabel, *text, *copy, *iv, *heat = NULL;
+    LOOP *l;
+    FILE *out;
+    TOKEN *body;
+    size_t size;
+    int i, trip, final, length, full, factor = 1, remainder = 0;
+    int budget = unrollBudget, first = !repeating;
+    double runs;
+    
+    l = (LOOP *)malloc(sizeof(LOOP));
+    l -> line = currentToken -> beginLine;
+    l -> writtenCount = l -> hoistCount = l -> operations = 0;
+    l -> outer = loop;
+    
+    consume(WHILE);
+    consume(LEFTPAREN);
+    cond = condition();
+    consume(RIGHTPAREN);
+    
+    bodyLabel = getLabel();
+    testLabel = getLabel();
+    
+    flushOutput();
+    body = currentToken;
+    scanStatement(body, l);
+    trip = tripCount(cond, body, l, &iv, &final);
+    out = outFile;
+    
+    // --profile-use: unrolling a body with a small share of the
+    // statement runs only costs code; one with a large share gets a
+    // larger budget
+    runs = profileUse ? profiled(body) : -1;
+    if (runs >= 0 && runs * 100 < profTotal * COLDSHARE)
+    {
+        budget = 0;
+        heat = "cold";
+    }
+    else if (runs > 0 && runs * 100 >= profTotal * HOTSHARE)
+    {
+        budget = unrollBudget * HOTBUDGET;
+        heat = "hot";
+    }
+    loop = l;
+    
+    // compile the body once to measure it
+    outFile = openBuffer(&copy, &size);
+    copyBody(body, l);
+    flushOutput();
+    fclose(outFile);
+    length = instructions(copy);
+    
+    // the loops in further copies of the body were reported when
+    // it was measured
+    repeating = TRUE;
+    outFile = openBuffer(&text, &size);
+    full = trip >= 0 && trip * length <= budget;
+    if (full)
+    {
+        factor = trip;
+        if (trip)
+            fputs(copy, outFile);
+        for (i = 1; i < trip; i++)
+            copyBody(body, l);
+    }
+    else
+    {
+        // of the factors from half the most that fit up, the one
+        // needing the fewest copies
+        if (trip >= 0 && budget / length > 1)
+        {
+            factor = budget / length;
+            remainder = trip % factor;
+            for (i = factor - 1; i > budget / length / 2; i--)
+                if (i + trip % i < factor + remainder)
+                {
+                    factor = i;
+                    remainder = trip % i;
+                }
+        }
+        for (i = 0; i < remainder; i++)
+            copyBody(body, l);
+        if (trip < 0)
+            emitInstruction2("ja", testLabel);
+        emitLabel(bodyLabel);
+        fputs(copy, outFile);
+        for (i = 1; i < factor; i++)
+            copyBody(body, l);
+        emitLabel(testLabel);
+        genBranch(cond, bodyLabel);
+    }
+    
+    loop = l -> outer;
+    fclose(outFile);
+    outFile = out;
+    
+    // preheader
+    for (i = 0; trip && i < l -> hoistCount; i++)
+    {
+        emitInstruction2("pc", l -> hoistName[i]);
+        genExpr(l -> hoisted[i]);
+        emitInstruction1("stav");
+    }
+    fputs(text, outFile);
+    free(text);
+    free(copy);
+    
+    forget(l);
+    if (trip >= 0)
+        setKnown(iv, TRUE, final);
+    
+    repeating = !first;
+    if (repeating)
+        return;
+    printf("\nLoop on line %d: %d operations in %d expressions hoisted\n",
+           l -> line, l -> operations, l -> hoistCount);
+    if (heat)
+        printf("Loop on line %d: profile: %s, body ran %.0f times, "
+               "unroll budget %d\n", l -> line, heat, runs, budget);
+    if (trip < 0)
+        printf("Loop on line %d: trip count unknown\n", l -> line);
+    else if (full)
+        printf("Loop on line %d: trip count %d, unrolled fully\n",
+               l -> line, trip);
+    else
+        printf("Loop on line %d: trip count %d, unrolled %d times, "
+               "%d copies ahead\n", l -> line, trip, factor, remainder);
+}
 //-----------------------------------------
 void statement(void)
 {
-   
+    if (instrument && (currentToken -> kind == ID || currentToken ->
+        kind == PRINTLN || currentToken -> kind == PRINT ||
+        currentToken -> kind == WHILE))
+        genCount(currentToken);
+    
     switch(currentToken -> kind)
     {
         case ID:
@@ -648,8 +1794,8 @@ void statement(void)
             printlnStatement();
             break;
 
-        case REPEAT: 
-            repeatStatement();
+        case WHILE:
+            whileStatement();
             break;
 
             
@@ -701,9 +1847,9 @@ void statementList(void)
             statementList();
             break;
 
-        case REPEAT:
-            repeatStatement();
-
+        case WHILE:
+            statement();
+            statementList();
             break;
             
         case RIGHTBRACKET:
@@ -719,8 +1865,6 @@ void statementList(void)
     }
 }
 //-----------------------------------------
-
-
 void program(void)
 {
     statementList();
@@ -735,19 +1879,44 @@ void parse(void)
 //-----------------------------------------
 int main(int argc, char *argv[])
 {
+    int argx;
+    
     printf("S2 compiler written by DYLAN SHEPPARD\n");
-    if (argc != 2)
+    if (argc < 2)
     {
         printf("Incorrect number of command line args\n");
         exit(1);
     }
     
+    // options precede the file name
+    for (argx = 1; argx < argc - 1; argx++)
+    {
+        if (!strncmp(argv[argx], "--unroll-budget=", 16))
+        {
+            unrollBudget = atoi(argv[argx] + 16);
+            if (unrollBudget < 0)
+            {
+                printf("--unroll-budget must not be negative\n");
+                exit(1);
+            }
+        }
+        else if (!strcmp(argv[argx], "--instrument"))
+            instrument = TRUE;
+        else if (!strncmp(argv[argx], "--profile-use=", 14))
+            readProfile(argv[argx] + 14);
+        else
+        {
+            printf("Unknown option %s\n", argv[argx]);
+            exit(1);
+        }
+    }
+
     
     // build the input and output file names
-    strcpy(inFileName, argv[1]);
+    strcpy(inFileName, argv[argc - 1]);
     strcat(inFileName, ".s");       // append extension
     
-    strcpy(outFileName, argv[1]);
+    strcpy(outFileName, argv[argc - 1]);
     strcat(outFileName, ".a");      // append extension
     
     inFile = fopen(inFileName, "r");
@@ -767,7 +1936,6 @@ int main(int argc, char *argv[])
     fprintf(outFile, "; Anthony J. Dos Reis    %s",
             asctime(localtime(&timer)));
 
-    fprintf(outFile, "!register");
     fprintf(outFile,
             "; Output from S2 compiler\n");
     
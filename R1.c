@@ -4,6 +4,8 @@
 #include <string.h> // needed by str functions
 #include <ctype.h>  // needed by isdigit, etc.
 #include <time.h>   // needed by asctime
+#include <setjmp.h> // needed by setjmp and longjmp
+#include "R1.h"     // needed by OPTIONS and compile
 
 // Constants
 
@@ -15,6 +17,10 @@
 // Sizes for arrays
 #define MAX 180            // size of string arrays
 #define SYMTABSIZE 1000    // symbol table size
+#define IRSIZE 10000       // IR instruction array size
+#define HASHSIZE 16384     // value numbering table, power of 2 > IRSIZE
+#define NUMREGS 8          // registers of the H1 register instruction set
+#define RUNSIZE 65536      // --run: instructions and data words
 
 #define END 0
 #define PRINTLN 1
@@ -33,6 +39,37 @@
 #define RIGHTBRACKET 14
 #define DIVIDE 15
 
+// IR opcodes
+#define IR_SOURCE 0        // source line, emitted as a comment
+#define IR_CONST 1         // constant con
+#define IR_LOAD 2          // initial value of variable sym
+#define IR_ADD 3           // a + b
+#define IR_MULT 4          // a * b
+#define IR_COPY 5          // replaced by value a
+#define IR_STORE 6         // variable sym = a
+#define IR_PRINT 7         // print(a)
+#define IR_PRINTLN 8       // println(a)
+#define IR_LEAF 9          // (rules only) value already in memory
+
+// Nonterminals for instruction selection
+#define NT_AC 0            // value in ac (register instruction set)
+#define NT_MEM 1           // value in a memory word or register
+#define NT_STACK 2         // value pushed on the stack
+#define NT_CONST 3         // constant
+#define NT_SMALL 4         // constant that fits the operand field
+#define NTCOUNT 5
+
+#define CHAIN -1           // op of a chain rule
+#define INFINITE 1000000   // cost of an impossible cover
+
+// operand of the instruction a rule emits
+#define OPND_NONE 0
+#define OPND_NAME 1        // memory word or register holding the value
+#define OPND_VALUE 2       // the constant itself
+#define OPND_TEMP 3        // a new @t temp
+#define OPND_MEM 4         // the child reduced to NT_MEM
+#define OPND_CONST 5       // the constant child
+
 time_t timer;    // for asctime
 
 // Prototypes
@@ -43,9 +80,17 @@ int expr(void);
 
 void statementList(void);
 
-void emitInt(char *op, int num);
+void emitInstruction1(char *op);
 
-//int factorList(int left);
+void emitInstruction2(char *op, char *opnd);
+
+void trackCost(char *op, char *opnd);
+
+int irEmit(int op, int a, int b);
+
+int storeBetween(int sym, int from, int to);
+void flushOutput(void);
+void addOutput(int i);
 
 // Global Variables
 
@@ -80,6 +125,147 @@ char *dwValue[SYMTABSIZE];      // new arrays for R1 that parralel SYMBTAB size
 int needsDW[SYMTABSIZE];
 
 int symbolx;                  // index into symbol table
+int current[SYMTABSIZE];      // value a variable holds, -1 if not yet used
+
+// SSA intermediate representation.  Instruction i defines value i
+// exactly once; operands a and b name earlier values.
+typedef struct
+{
+    int op;
+    int a, b;           // operand values
+    int sym;            // symbol index for IR_LOAD and IR_STORE
+    int con;            // value of IR_CONST
+    char *text;         // source line of IR_SOURCE
+    int dead;           // deleted by a pass
+} IRINST;
+
+IRINST ir[IRSIZE];
+int irx;                      // index into ir
+char *loc[IRSIZE];            // memory word holding each value
+int uses[IRSIZE], lastUse[IRSIZE];
+int remaining[IRSIZE];        // uses of each value not yet emitted
+int directStore[IRSIZE];      // store or print a value goes to, or -1
+int interior[IRSIZE];         // TRUE: computed inside its user's tree
+int emitAt[IRSIZE];           // instruction where the value is computed
+
+// Instruction selection.  A rule rewrites a value of kind op whose
+// operands are in nonterminals left and right into nonterminal
+// lhs, emitting instr.  A chain rule (op CHAIN) rewrites
+// nonterminal left into lhs.  Costs are H1 memory cycles: one per
+// instruction word fetched plus one per data or stack word read or
+// written.  The register and stack instruction sets share the
+// table; each backend reduces to its own goal nonterminal.
+typedef struct
+{
+    int lhs;            // nonterminal produced
+    int op;             // IR opcode matched, IR_LEAF, or CHAIN
+    int left, right;    // nonterminals of operands, -1 for a leaf
+    int small;          // TRUE: constant must fit 0 to 4095
+    int cost;
+    char *instr;        // NULL if rule emits nothing
+    int operand;        // OPND_ kind of instr's operand
+} RULE;
+
+RULE rules[] =
+{
+    {NT_CONST, IR_CONST, -1,       -1,       FALSE, 0, NULL,   OPND_NONE},
+    {NT_SMALL, IR_CONST, -1,       -1,       TRUE,  0, NULL,   OPND_NONE},
+    
+    // register instruction set
+    {NT_MEM,   IR_LEAF,  -1,       -1,       FALSE, 0, NULL,   OPND_NAME},
+    {NT_MEM,   IR_LOAD,  -1,       -1,       FALSE, 0, NULL,   OPND_NAME},
+    {NT_MEM,   CHAIN,    NT_CONST, -1,       FALSE, 0, NULL,   OPND_NAME},
+    {NT_AC,    CHAIN,    NT_MEM,   -1,       FALSE, 2, "ld",   OPND_MEM},
+    {NT_AC,    CHAIN,    NT_SMALL, -1,       FALSE, 1, "ldc",  OPND_VALUE},
+    {NT_MEM,   CHAIN,    NT_AC,    -1,       FALSE, 2, "st",   OPND_TEMP},
+    {NT_AC,    IR_ADD,   NT_AC,    NT_MEM,   FALSE, 2, "add",  OPND_MEM},
+    {NT_AC,    IR_ADD,   NT_MEM,   NT_AC,    FALSE, 2, "add",  OPND_MEM},
+    {NT_AC,    IR_MULT,  NT_AC,    NT_MEM,   FALSE, 2, "mult", OPND_MEM},
+    {NT_AC,    IR_MULT,  NT_MEM,   NT_AC,    FALSE, 2, "mult", OPND_MEM},
+    
+    // stack instruction set
+    {NT_STACK, IR_LEAF,  -1,       -1,       FALSE, 3, "p",    OPND_NAME},
+    {NT_STACK, IR_LOAD,  -1,       -1,       FALSE, 3, "p",    OPND_NAME},
+    {NT_STACK, CHAIN,    NT_CONST, -1,       FALSE, 3, "pwc",  OPND_VALUE},
+    {NT_STACK, CHAIN,    NT_SMALL, -1,       FALSE, 2, "pc",   OPND_VALUE},
+    {NT_STACK, IR_ADD,   NT_STACK, NT_STACK, FALSE, 4, "add",  OPND_NONE},
+    {NT_STACK, IR_ADD,   NT_STACK, NT_CONST, FALSE, 4, "awc",  OPND_CONST},
+    {NT_STACK, IR_ADD,   NT_CONST, NT_STACK, FALSE, 4, "awc",  OPND_CONST},
+    {NT_STACK, IR_MULT,  NT_STACK, NT_STACK, FALSE, 4, "mult", OPND_NONE}
+};
+#define RULECOUNT (int)(sizeof(rules) / sizeof(rules[0]))
+
+// Static cost model.  Cycles are counted as in the rules, for an
+// instruction with no operand in each instruction set, with a
+// memory or immediate operand, and with a %r operand.  R1 code has
+// no jumps, so each instruction runs once and the static count is
+// the cost of a run.
+typedef struct
+{
+    char *op;
+    int words;          // instruction words
+    int stack;          // cycles with no operand, stack set
+    int ac;             // cycles with no operand, register set
+    int memory;         // cycles with a memory or immediate operand
+    int reg;            // cycles with a %r operand
+} COST;
+
+COST costs[] =
+{
+    {"p",    1, 0, 0, 3, 0}, {"pc",   1, 0, 0, 2, 0},
+    {"pwc",  2, 0, 0, 3, 0}, {"awc",  2, 0, 0, 4, 0},
+    {"add",  1, 4, 0, 2, 1}, {"mult", 1, 4, 0, 2, 1},
+    {"ld",   1, 0, 0, 2, 1}, {"ldc",  1, 0, 0, 1, 0},
+    {"st",   1, 0, 0, 2, 1}, {"stav", 1, 4, 0, 0, 0},
+    {"dout", 1, 2, 1, 0, 0}, {"aout", 1, 2, 2, 0, 0},
+    {"sout", 1, 2, 2, 0, 0}, {"halt", 1, 1, 1, 0, 0}
+};
+#define COSTCOUNT (int)(sizeof(costs) / sizeof(costs[0]))
+
+int codeCycles, codeWords;    // cost of the code emitted so far
+
+int nodeCost[IRSIZE][NTCOUNT];  // cheapest cover of each value
+int nodeRule[IRSIZE][NTCOUNT];  // rule giving that cost
+
+// values and temps named by operands not yet emitted
+int pendingValue[IRSIZE], pendingTemp[IRSIZE];
+int pendingx;
+
+// temps @t0, @t1, ... are numbered, not entered in symbol table
+char *tempName[IRSIZE];
+int tempOf[IRSIZE];           // temp holding each value, -1 if none
+int tempCount;                // temps created
+int freeTemps[IRSIZE];        // pool of temps free for reuse
+int freeTempx;
+
+// constant pool: poolEntry[c + 32768] names the word holding
+// constant c, NULL if c is not in the pool
+char *poolEntry[65536];
+int poolSize, poolLookups, poolHits;
+
+int optLevel = 0;             // -O0, -O1, -O2
+int timePasses = FALSE;       // --time-passes
+int stackTarget = FALSE;      // --stack: emit stack instruction set
+int stats = FALSE;            // --stats: report code statistics
+int autoTarget = FALSE;       // --auto: emit the cheaper of the two
+int runProgram = FALSE;       // --run: execute the program after compiling
+
+// registers available to the allocator (--regs=N)
+int numRegs = NUMREGS;
+char *regName[NUMREGS] =
+{
+    "%r0", "%r1", "%r2", "%r3", "%r4", "%r5", "%r6", "%r7"
+};
+int operandOps, memoryOps;    // operand / memory operand instructions
+
+// Coalesced output.  The text of a print or println of a constant
+// is added to outText.  A run of such text is printed by one sout
+// when the print of a computed value or the end of the program
+// follows.
+char outText[MAX + 20];
+char *stringText[IRSIZE];     // @str dw strings, emitted by endCode
+int stringCount;
+int coalescedCount;           // print/println instructions in strings
 
 //create new type named TOKEN
 typedef struct tokentype
@@ -92,27 +278,47 @@ typedef struct tokentype
 
 
 FILE *inFile, *outFile;     // file pointers
+FILE *msgFile;              // errors and reports: stdout, or memory
+
+// A compile run by compile.  The source is read and the code and
+// messages written through memory streams, and abend returns here
+// with longjmp in place of exiting.  The rest of the compiler's
+// state stays in the globals, so compiles are serial; see R1.h.
+typedef struct
+{
+    jmp_buf failure;        // where abend returns
+    char *code;             // .a text
+    size_t codeSize;
+    char *messages;         // errors and reports
+    size_t messagesSize;
+} CONTEXT;
+
+CONTEXT *context;           // compile running, NULL for the command line
 
 int currentChar = '\n';
 int currentColumnNumber;
 int currentLineNumber;
 TOKEN *currentToken;
 TOKEN *previousToken;
+TOKEN *firstToken;          // head of the token list, NULL before parse
 
 //-----------------------------------------
 // Abnormal end.
-// Close files so S2.a has max info for debugging
+// Close files so S2.a has max info for debugging.  Within compile,
+// return to it instead of exiting.
 void abend(void)
 {
     fclose(inFile);
     fclose(outFile);
+    if (context)
+        longjmp(context -> failure, 1);
     exit(1);
 }
 //-----------------------------------------
 void displayErrorLoc(void)
 {
-    printf("Error on line %d column %d\n", currentToken ->
-           beginLine, currentToken -> beginColumn);
+    fprintf(msgFile, "Error on line %d column %d\n", currentToken ->
+            beginLine, currentToken -> beginColumn);
 }
 //-----------------------------------------
 // enter symbol into symbol table if not already there
@@ -126,28 +332,22 @@ int enter(char *s, char *v, int boo)
         i++;
     }
     
-    if (i >= 0) {
+    if (i < symbolx) {
         return i; //already in symbol table, return it
     }
 
-    else {
     // if s is not in symbol table, then add it
-    
-    if (i == symbolx)
-        if (symbolx < SYMTABSIZE) {
-            i = symbolx++;
-            symbol[i] = s; //add symbol
-            dwValue[i] = v;
-            needsDW[i] = boo;
-            return i;
-        }
-        else
-        {
-            printf("System error: symbol table overflow\n");
-            abend();
-        }
-
+    if (symbolx >= SYMTABSIZE)
+    {
+        fprintf(msgFile, "System error: symbol table overflow\n");
+        abend();
     }
+    i = symbolx++;
+    symbol[i] = s; //add symbol
+    dwValue[i] = v;
+    needsDW[i] = boo;
+    current[i] = -1;
+    return i;
 }
 //-----------------------------------------
 void getNextChar(void)
@@ -160,8 +360,9 @@ void getNextChar(void)
         // fgets returns 0 (false) on EOF
         if (fgets(inputLine, sizeof(inputLine), inFile))
         {
-            // output source line as comment
-            fprintf(outFile, "; %s", inputLine);
+            // record source line; it is output as a comment
+            // in front of the code generated from it
+            ir[irEmit(IR_SOURCE, -1, -1)].text = strdup(inputLine);
             currentColumnNumber = 0;
             currentLineNumber++;
         }
@@ -333,14 +534,8 @@ TOKEN *getNextToken(void)
 //
 void advance(void)
 {
-    static int firstTime = TRUE;
-    
-    
-    if (firstTime)
-    {
-        firstTime = FALSE;
-        currentToken = getNextToken();
-    }
+    if (!firstToken)
+        currentToken = firstToken = getNextToken();
     else
     {
         previousToken = currentToken;
@@ -368,8 +563,8 @@ void consume(int expected)
     else
     {
         displayErrorLoc();
-        printf("Scanning %s, expecting %s\n",
-               currentToken -> image, tokenImage[expected]);
+        fprintf(msgFile, "Scanning %s, expecting %s\n",
+                currentToken -> image, tokenImage[expected]);
         abend();
     }
 }
@@ -402,240 +597,1282 @@ TOKEN *getToken(int i)
     return t;
 }
 
-//R1 function: adds now done via symbol table and temp variables
+// wrap an int to the 16-bit two's complement range of an H1 word
+int wrap16(int v)
+{
+    return ((v + 32768) & 0xffff) - 32768;
+}
+//-----------------------------------------
+// append an instruction to the IR; returns the value it defines
+int irEmit(int op, int a, int b)
+{
+    if (irx >= IRSIZE)
+    {
+        fprintf(msgFile, "System error: IR overflow\n");
+        abend();
+    }
+    ir[irx].op = op;
+    ir[irx].a = a;
+    ir[irx].b = b;
+    ir[irx].sym = -1;
+    ir[irx].con = 0;
+    ir[irx].text = NULL;
+    ir[irx].dead = FALSE;
+    return irx++;
+}
+//-----------------------------------------
+int irConst(int c)
+{
+    int v = irEmit(IR_CONST, -1, -1);
+    ir[v].con = wrap16(c);
+    return v;
+}
+//-----------------------------------------
+// follow IR_COPY links to the value that replaced v
+int irValue(int v)
+{
+    while (ir[v].op == IR_COPY)
+        v = ir[v].a;
+    return v;
+}
+//-----------------------------------------
+// value v is replaced by value w everywhere it is used
+void irReplace(int v, int w)
+{
+    ir[v].op = IR_COPY;
+    ir[v].a = w;
+    ir[v].b = -1;
+}
+//-----------------------------------------
+// TRUE if op defines a value (has no side effect)
+int isValueOp(int op)
+{
+    return op == IR_CONST || op == IR_LOAD || op == IR_ADD ||
+           op == IR_MULT || op == IR_COPY;
+}
+//-----------------------------------------
+// current value of a variable.  The first use of a variable loads
+// it from memory; after an assignment its uses name the assigned
+// value directly, so the IR is in SSA form as it is built.
+int useVariable(char *name)
+{
+    int i, v;
+    i = enter(name, "0", TRUE);
+    if (current[i] < 0)
+    {
+        v = irEmit(IR_LOAD, -1, -1);
+        ir[v].sym = i;
+        current[i] = v;
+    }
+    return current[i];
+}
+//-----------------------------------------
+//R1 function: adds now done via IR values
 int add(int left, int right) {
-    emitInt("ld", left);
-    emitInt("add", right);
-    int temp = getTemp();
-    emitInt("st", temp);
-    return temp;
+    return irEmit(IR_ADD, left, right);
 }
 
 
 int mult(int left, int right) {
-    emitInt("ld", left);
-    emitInt("mult", right);
-    int temp = getTemp();
-    emitInt("st", temp);
-    return temp;
+    return irEmit(IR_MULT, left, right);
 }
 
-//R1 function: returns a unique label of a temp variable to be used by machine code
+//R1 function: returns the number of a free temp variable.  Temp n
+//is the memory word @tn.  Temps are recycled, so the number of @t
+//words is the most ever live at once, not the number of values.
 
 int getTemp() {
-        static int count = 0; //static so it's contents are saved after function call
-       char lbuf[10];
-       sprintf(lbuf, "@t%d", count++);  
-       strdup(lbuf);
-       return enter(lbuf, 0, TRUE);
-     
+    char lbuf[20];
+    
+    if (freeTempx > 0)
+        return freeTemps[--freeTempx];
+    if (tempCount >= IRSIZE)
+    {
+        fprintf(msgFile, "System error: temp overflow\n");
+        abend();
+    }
+    sprintf(lbuf, "@t%d", tempCount);
+    tempName[tempCount] = strdup(lbuf);
+    return tempCount++;
 }
 //-----------------------------------------
-// emit one-operand instruction
-void emitInstruction1(char *op)
+// return temp t to the free pool
+void freeTemp(int t)
 {
-    fprintf(outFile, "          %-4s\n", op);
+    freeTemps[freeTempx++] = t;
 }
 //-----------------------------------------
-// emit two-operand instruction
-// function overloading not supported by C
-void emitInstruction2(char *op, char *opnd)
+// one use of value v has been emitted.  After its last use, the
+// temp holding v (if any) is free for another value.
+void useDone(int v)
 {
-    fprintf(outFile,
-            "          %-4s      %s\n", op,opnd);
+    if (--remaining[v] == 0 && tempOf[v] >= 0)
+        freeTemp(tempOf[v]);
 }
-//R1 must support integers in machine instructions
-void emitInt(char *op, int num) {
-    fprintf(outFile, " %-4s      %d\n", op,num);
+//-----------------------------------------
+// put value v in a new temp
+void toTemp(int v)
+{
+    tempOf[v] = getTemp();
+    loc[v] = tempName[tempOf[v]];
 }
 //-----------------------------------------
-void emitdw(char *label, char *value)
+// returns name of the constant pool entry holding c, adding the
+// entry the first time c is seen.  The pool is indexed by value,
+// so +5, 5, and 005 share the entry @5.
+char *constName(int c)
 {
-    char temp[80];
-    strcpy(temp, label);
-    strcat(temp, ":");
+    char name[20];
     
-    fprintf(outFile,
-            "%-9s dw        %s\n", temp, value);
+    poolLookups++;
+    if (poolEntry[c + 32768])
+    {
+        poolHits++;
+        return poolEntry[c + 32768];
+    }
+    
+    if (c < 0)
+        sprintf(name, "@_%d", -c);
+    else
+        sprintf(name, "@%d", c);
+    poolEntry[c + 32768] = strdup(name);
+    poolSize++;
+    return poolEntry[c + 32768];
 }
 //-----------------------------------------
-void endCode(void)
+// Optimization passes.  Each returns the number of changes made.
+//
+// fold: evaluate + and * of constants (16-bit), and simplify
+// x + 0, x * 1, x * 0
+int foldPass(void)
 {
-    int i;
-    emitInstruction1("\n          halt\n");
+    int i, a, b, t, c, changes = 0;
     
-    // emit dw for each symbol in the symbol table
-    for (i=0; i < symbolx; i++) {
-        if(needsDW[i] == TRUE)
-             emitdw(symbol[i], dwValue[i]);
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || (ir[i].op != IR_ADD && ir[i].op != IR_MULT))
+            continue;
+        a = irValue(ir[i].a);
+        b = irValue(ir[i].b);
+        
+        // keep a constant operand on the right
+        if (ir[a].op == IR_CONST && ir[b].op != IR_CONST)
+        {
+            t = a;
+            a = b;
+            b = t;
+        }
+        
+        if (ir[a].op == IR_CONST && ir[b].op == IR_CONST)
+        {
+            if (ir[i].op == IR_ADD)
+                c = ir[a].con + ir[b].con;
+            else
+                c = ir[a].con * ir[b].con;
+            ir[i].op = IR_CONST;
+            ir[i].con = wrap16(c);
+            changes++;
+        }
+        else if (ir[b].op == IR_CONST &&
+                 ((ir[i].op == IR_ADD && ir[b].con == 0) ||
+                  (ir[i].op == IR_MULT && ir[b].con == 1)))
+        {
+            irReplace(i, a);
+            changes++;
+        }
+        else if (ir[b].op == IR_CONST && ir[i].op == IR_MULT &&
+                 ir[b].con == 0)
+        {
+            ir[i].op = IR_CONST;
+            ir[i].con = 0;
+            changes++;
+        }
     }
+    return changes;
 }
 //-----------------------------------------
-
-
-void assign(int left, int expVal) {
-    emitInt("ld", expVal);
-    emitInstruction2("st", symbol[left]);
-
-}
-
-void println(int expVal) {
-    emitInstruction2("ld", symbol[expVal]);
-    emitInstruction1("dout");
-    emitInstruction2("pc", "'\\n'");
-    emitInstruction1("aout");
+// reassoc: gather the constants of a chain of + (or of *) into one
+// operand.  x + 1 + y + 2 parses as ((x + 1) + y) + 2 and becomes
+// (x + 3) + y.  + and * are associative and commutative in 16
+// bits, so the result is bit-identical.  The sums inside a chain
+// are used only by the chain, so the chain is rebuilt in their
+// instructions: the first holds the folded constant and the last
+// stays the chain's value.  The remaining operands keep the order
+// they are defined in, so each is still defined before its use.
+int reassocPass(void)
+{
+    static int count[IRSIZE], user[IRSIZE];
+    static int node[IRSIZE], leaf[IRSIZE], work[IRSIZE];
+    int i, j, k, v, op, c, acc;
+    int nodex, leafx, workx, constx, identity, need, unused;
+    int changes = 0;
+    
+    for (i = 0; i < irx; i++)
+        count[i] = 0;
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || ir[i].op == IR_SOURCE || ir[i].op == IR_CONST ||
+            ir[i].op == IR_LOAD || ir[i].op == IR_COPY)
+            continue;
+        v = irValue(ir[i].a);
+        count[v]++;
+        user[v] = i;
+        if (ir[i].op == IR_ADD || ir[i].op == IR_MULT)
+        {
+            v = irValue(ir[i].b);
+            count[v]++;
+            user[v] = i;
+        }
+    }
     
+    for (i = 0; i < irx; i++)
+    {
+        op = ir[i].op;
+        if (ir[i].dead || (op != IR_ADD && op != IR_MULT))
+            continue;
+        // only the root of a chain
+        if (count[i] == 1 && ir[user[i]].op == op)
+            continue;
+        
+        // collect the chain's instructions and operands
+        nodex = leafx = constx = 0;
+        c = op == IR_ADD ? 0 : 1;
+        work[0] = i;
+        workx = 1;
+        while (workx > 0)
+        {
+            v = work[--workx];
+            if (v == i || (ir[v].op == op && count[v] == 1))
+            {
+                node[nodex++] = v;
+                work[workx++] = irValue(ir[v].a);
+                work[workx++] = irValue(ir[v].b);
+            }
+            else if (ir[v].op == IR_CONST)
+            {
+                c = wrap16(op == IR_ADD ? c + ir[v].con : c * ir[v].con);
+                constx++;
+            }
+            else
+                leaf[leafx++] = v;
+        }
+        if (constx < 2)
+            continue;
+        
+        // in order of definition
+        for (j = 1; j < nodex; j++)
+            for (k = j; k > 0 && node[k - 1] > node[k]; k--)
+            {
+                v = node[k];
+                node[k] = node[k - 1];
+                node[k - 1] = v;
+            }
+        for (j = 1; j < leafx; j++)
+            for (k = j; k > 0 && leaf[k - 1] > leaf[k]; k--)
+            {
+                v = leaf[k];
+                leaf[k] = leaf[k - 1];
+                leaf[k - 1] = v;
+            }
+        
+        changes++;
+        for (j = 0; j < nodex - 1; j++)
+            ir[node[j]].dead = TRUE;
+        if (leafx == 0 || (op == IR_MULT && c == 0))
+        {
+            ir[i].op = IR_CONST;
+            ir[i].con = c;
+            continue;
+        }
+        identity = op == IR_ADD ? c == 0 : c == 1;
+        if (identity && leafx == 1)
+        {
+            irReplace(i, leaf[0]);
+            continue;
+        }
+        
+        // x op c first, then the other operands one at a time
+        need = identity ? leafx - 1 : leafx;
+        unused = nodex - need;
+        acc = leaf[0];
+        k = 1;
+        if (!identity)
+        {
+            ir[node[0]].dead = FALSE;
+            ir[node[0]].op = IR_CONST;
+            ir[node[0]].con = c;
+            ir[node[0]].a = ir[node[0]].b = -1;
+        }
+        for (j = unused; j < nodex; j++)
+        {
+            ir[node[j]].dead = FALSE;
+            ir[node[j]].a = acc;
+            ir[node[j]].b = j == unused && !identity ? node[0] :
+                            leaf[k++];
+            acc = node[j];
+        }
+    }
+    return changes;
 }
-int factor(void)
+//-----------------------------------------
+// cse: value numbering.  A constant, sum, or product equal to an
+// earlier one is replaced by it.  + and * are commutative, so
+// operands are put in order before lookup.
+int csePass(void)
 {
-    TOKEN *t;
-    char temp[MAX];
-    char temp2[20]; //two temps needed for minus
-    int index;
+    static int table[HASHSIZE];
+    int i, j, a, b, t, h, changes = 0;
     
-    printf("%s ", currentToken -> image);
-    switch(currentToken -> kind)
+    for (h = 0; h < HASHSIZE; h++)
+        table[h] = -1;
+    
+    for (i = 0; i < irx; i++)
     {
-        case UNSIGNED:
-            t = currentToken;
-            consume(UNSIGNED);
-            //sprintf(temp, "@%s", t -> image);
-             strcpy(temp,"@");
-            strcat(temp, t -> image);
-            index = enter(temp, t -> image, TRUE);
-            return index;
-            break;
-
-        case PLUS:
-            consume(PLUS);
-            t = currentToken;
-            consume(UNSIGNED);
-
-           // sprintf(temp, "@%s", t -> image);
-             strcpy(temp,"@");
-            strcat(temp, t -> image);
-            index = enter(temp, t -> image, TRUE);
-            return index;
-            break;
-
-        case MINUS:
-            consume(MINUS);
-            t = currentToken;
-            consume(UNSIGNED);
-            //sprintf(temp2, "@_%s", t -> image);
-            strcpy(temp2,"@_");
-            strcat(temp2, t -> image);
-            strcpy(temp, "-");
-            strcat(temp, t -> image);
-           index = enter(temp2, temp, TRUE);
-            return index;
-            break;
-
-        case ID:
-            t = currentToken;
-            consume(ID);
-            index = enter(t -> image, "0", TRUE);
-            return index;
-            break;
-        case LEFTPAREN:
-            consume(LEFTPAREN);
-            index = expr();
-            consume(RIGHTPAREN);
-            return index;
-            break;
-        default:
-            displayErrorLoc();
-            printf("Scanning %s, expecting factor\n", currentToken ->
-                   image);
-            abend();
+        if (ir[i].dead || (ir[i].op != IR_CONST && ir[i].op != IR_ADD &&
+                           ir[i].op != IR_MULT))
+            continue;
+        
+        a = b = -1;
+        if (ir[i].op != IR_CONST)
+        {
+            a = irValue(ir[i].a);
+            b = irValue(ir[i].b);
+            if (a > b)
+            {
+                t = a;
+                a = b;
+                b = t;
+            }
+            ir[i].a = a;
+            ir[i].b = b;
+        }
+        
+        h = (unsigned)(ir[i].op * 31 + a * 977 + b * 7919 + ir[i].con)
+            & (HASHSIZE - 1);
+        while ((j = table[h]) >= 0)
+        {
+            if (ir[j].op == ir[i].op && ir[j].a == a && ir[j].b == b &&
+                ir[j].con == ir[i].con)
+                break;
+            h = (h + 1) & (HASHSIZE - 1);
+        }
+        
+        if (j >= 0)
+        {
+            irReplace(i, j);
+            changes++;
+        }
+        else
+            table[h] = i;
     }
+    return changes;
 }
 //-----------------------------------------
-int factorList(int left) {
-int right,temp, termVal;
-
-
-    if (currentToken -> kind == TIMES) {
-        consume(TIMES);
-        right = factor();
-        temp = mult(left,right);
-        termVal = factorList(temp);
-        return termVal;
+// dse: delete a store to a variable that is stored again before
+// it is loaded
+int dsePass(void)
+{
+    static int storedLater[SYMTABSIZE];
+    int i, changes = 0;
+    
+    for (i = 0; i < symbolx; i++)
+        storedLater[i] = FALSE;
+    
+    for (i = irx - 1; i >= 0; i--)
+    {
+        if (ir[i].dead)
+            continue;
+        if (ir[i].op == IR_STORE)
+        {
+            if (storedLater[ir[i].sym])
+            {
+                ir[i].dead = TRUE;
+                changes++;
+            }
+            storedLater[ir[i].sym] = TRUE;
+        }
+        else if (ir[i].op == IR_LOAD)
+            storedLater[ir[i].sym] = FALSE;
     }
-
-    else {
-        return left;
+    return changes;
+}
+//-----------------------------------------
+// dce: delete values that are never used.  Users follow the
+// values they use, so one backward sweep removes whole chains.
+int dcePass(void)
+{
+    static int count[IRSIZE];
+    int i, changes = 0;
+    
+    for (i = 0; i < irx; i++)
+        count[i] = 0;
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || ir[i].op == IR_SOURCE || ir[i].op == IR_CONST ||
+            ir[i].op == IR_LOAD)
+            continue;
+        count[ir[i].a]++;
+        if (ir[i].op == IR_ADD || ir[i].op == IR_MULT)
+            count[ir[i].b]++;
     }
-
-    /**
-    switch(currentToken -> kind)
+    
+    for (i = irx - 1; i >= 0; i--)
     {
-        case TIMES:
-            consume(TIMES);
-            factor();
-            emitInstruction1("mult");
-            factorList();
-            break;
-            
-        case DIVIDE:
-            consume(DIVIDE);
-            factor();
-            emitInstruction1("div");
-            factorList();
-            break;
-            
-        case PLUS:
-        case MINUS: //adding MINUS, telling compiler to simply proceed if a MINUS token appears (lambda)
-            
-            
-        case RIGHTPAREN:
-        case SEMICOLON:
-            ;
-            break;
-        default:
-            displayErrorLoc();
-            printf("Scanning %s, expecting op, \")\", or \";\"\n",
-                   currentToken -> image);
-            abend();
+        if (ir[i].dead || !isValueOp(ir[i].op) || count[i] > 0)
+            continue;
+        ir[i].dead = TRUE;
+        changes++;
+        if (ir[i].op == IR_CONST || ir[i].op == IR_LOAD)
+            continue;
+        count[ir[i].a]--;
+        if (ir[i].op == IR_ADD || ir[i].op == IR_MULT)
+            count[ir[i].b]--;
     }
-
-    */
+    return changes;
 }
 //-----------------------------------------
-int term(void)
+// Pass manager: runs, in order, every pass whose level is at
+// most the -O level, recording changes and time for each run.
+typedef struct
 {
-    int left, termVal;
-    left = factor();
-    termVal = factorList(left);
-    return termVal;
+    char *name;
+    int (*run)(void);
+    int level;          // lowest -O level that runs the pass
+} PASS;
+
+PASS passList[] =
+{
+    {"fold", foldPass, 1},
+    {"reassoc", reassocPass, 1},
+    {"cse",  csePass,  2},
+    {"dse",  dsePass,  2},
+    {"dce",  dcePass,  1}
+};
+#define PASSCOUNT (int)(sizeof(passList) / sizeof(passList[0]))
+
+void runPasses(void)
+{
+    int p, changes, total = 0;
+    clock_t start;
+    double ms, totalms = 0;
+    
+    if (timePasses)
+        fprintf(msgFile, "\n%-10s %8s %10s\n", "pass", "changes",
+                "time(ms)");
+    
+    for (p = 0; p < PASSCOUNT; p++)
+    {
+        if (passList[p].level > optLevel)
+            continue;
+        start = clock();
+        changes = passList[p].run();
+        ms = 1000.0 * (clock() - start) / CLOCKS_PER_SEC;
+        total += changes;
+        totalms += ms;
+        if (timePasses)
+            fprintf(msgFile, "%-10s %8d %10.3f\n", passList[p].name,
+                    changes, ms);
+    }
+    
+    if (timePasses)
+        fprintf(msgFile, "%-10s %8d %10.3f\n", "total", total, totalms);
 }
 //-----------------------------------------
-int termList(int left)
+// Lowering.  loc[v] names the memory word holding value v once it
+// has been computed.  uses[v] and lastUse[v] are counted over the
+// live instructions, with COPY links followed.
+void computeUses(void)
 {
-    int right, temp, expVal;
+    int i, lastLive = -1;
+    
+    for (i = 0; i < irx; i++)
+    {
+        uses[i] = lastUse[i] = 0;
+        tempOf[i] = -1;
+    }
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || ir[i].op == IR_SOURCE || ir[i].op == IR_CONST ||
+            ir[i].op == IR_LOAD || ir[i].op == IR_COPY)
+            continue;
+        ir[i].a = irValue(ir[i].a);
+        uses[ir[i].a]++;
+        lastUse[ir[i].a] = i;
+        if (ir[i].op == IR_ADD || ir[i].op == IR_MULT)
+        {
+            ir[i].b = irValue(ir[i].b);
+            uses[ir[i].b]++;
+            lastUse[ir[i].b] = i;
+        }
+    }
+    
+    for (i = 0; i < irx; i++)
+        remaining[i] = uses[i];
+    
+    // Destination-driven assignment: a computed value stored by the
+    // instruction right after it is computed straight into the
+    // variable, with no temp and no ld/st pair for the store.  Its
+    // later uses read the variable, so the variable must not be
+    // assigned again before the value's last use.  Likewise a sum
+    // or product printed right after it is computed is left in ac.
+    for (i = 0; i < irx; i++)
+        directStore[i] = -1;
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || ir[i].op == IR_SOURCE)
+            continue;
+        if ((ir[i].op == IR_PRINT || ir[i].op == IR_PRINTLN) &&
+            ir[i].a == lastLive && uses[lastLive] == 1 &&
+            (ir[lastLive].op == IR_ADD || ir[lastLive].op == IR_MULT))
+            directStore[lastLive] = i;
+        if (ir[i].op == IR_STORE && ir[i].a == lastLive &&
+            ir[lastLive].op != IR_CONST &&
+            (ir[lastLive].op != IR_LOAD ||
+             storeBetween(ir[lastLive].sym, lastLive, lastUse[lastLive])) &&
+            !storeBetween(ir[i].sym, i, lastUse[lastLive]))
+            directStore[lastLive] = i;
+        lastLive = i;
+    }
+    
+    // A sum or product used once, by a sum or product (in stack
+    // code, by anything), with no store in between is matched into
+    // its user's tree.  It is computed where the root of the tree
+    // is, so its operands stay live until there.
+    for (i = irx - 1; i >= 0; i--)
+    {
+        interior[i] = FALSE;
+        emitAt[i] = i;
+        if (ir[i].dead || (ir[i].op != IR_ADD && ir[i].op != IR_MULT) ||
+            uses[i] != 1 || storeBetween(-1, i, lastUse[i]))
+            continue;
+        if (!stackTarget && ir[lastUse[i]].op != IR_ADD &&
+            ir[lastUse[i]].op != IR_MULT)
+            continue;
+        interior[i] = TRUE;
+        emitAt[i] = emitAt[lastUse[i]];
+    }
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || (ir[i].op != IR_ADD && ir[i].op != IR_MULT))
+            continue;
+        if (lastUse[ir[i].a] < emitAt[i])
+            lastUse[ir[i].a] = emitAt[i];
+        if (lastUse[ir[i].b] < emitAt[i])
+            lastUse[ir[i].b] = emitAt[i];
+    }
+}
+//-----------------------------------------
+// TRUE if a live store to sym (any symbol if sym < 0) lies
+// strictly between IR instructions from and to
+int storeBetween(int sym, int from, int to)
+{
+    int i;
+    for (i = from + 1; i < to; i++)
+        if (!ir[i].dead && ir[i].op == IR_STORE &&
+            (sym < 0 || ir[i].sym == sym))
+            return TRUE;
+    return FALSE;
+}
+//-----------------------------------------
+// TRUE if value i must be kept somewhere other than its variable
+// or constant pool entry: sums and products, and loads of a
+// variable that is assigned before the value's last use.  A value
+// stored directly into its destination, or computed inside its
+// user's tree, needs no temp.
+int needsTemp(int i)
+{
+    if (directStore[i] >= 0 || interior[i])
+        return FALSE;
+    if (ir[i].op == IR_ADD || ir[i].op == IR_MULT)
+        return uses[i] > 0;
+    if (ir[i].op == IR_LOAD)
+        return storeBetween(ir[i].sym, i, lastUse[i]);
+    return FALSE;
+}
+//-----------------------------------------
+// Linear-scan register allocation (-O1 and up).  The live
+// interval of value i runs from i to lastUse[i].  Intervals are
+// visited in order of start; one that ends at i frees its register
+// for i, since an instruction reads its operands before it writes
+// its result.  When all registers are in use, the interval that
+// ends last is spilled to memory for its whole length.  A second
+// scan gives the spilled intervals @t slots, and the slot of an
+// interval that has ended goes back to the temp pool.
+void allocateRegisters(void)
+{
+    static int active[NUMREGS], live[IRSIZE];
+    static int reg[IRSIZE], spilled[IRSIZE];
+    int freeReg[NUMREGS];
+    int activex = 0, livex = 0, freeRegx = 0;
+    int i, j, k, victim;
+    
+    for (k = numRegs - 1; k >= 0; k--)
+        freeReg[freeRegx++] = k;
+    
+    for (i = 0; i < irx; i++)
+    {
+        spilled[i] = FALSE;
+        if (ir[i].dead || !needsTemp(i))
+            continue;
+        
+        // expire intervals that end at or before i
+        for (j = k = 0; j < activex; j++)
+            if (lastUse[active[j]] <= i)
+                freeReg[freeRegx++] = reg[active[j]];
+            else
+                active[k++] = active[j];
+        activex = k;
+        
+        victim = i;
+        if (freeRegx > 0)
+        {
+            reg[i] = freeReg[--freeRegx];
+            active[activex++] = i;
+            victim = -1;
+        }
+        else if (activex > 0)
+        {
+            // spill whichever interval ends last
+            k = 0;
+            for (j = 1; j < activex; j++)
+                if (lastUse[active[j]] > lastUse[active[k]])
+                    k = j;
+            if (lastUse[active[k]] > lastUse[i])
+            {
+                victim = active[k];
+                reg[i] = reg[victim];
+                active[k] = i;
+            }
+        }
+        if (victim >= 0)
+            spilled[victim] = TRUE;
+    }
+    
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead || !needsTemp(i))
+            continue;
+        if (!spilled[i])
+        {
+            loc[i] = regName[reg[i]];
+            continue;
+        }
+        
+        for (j = k = 0; j < livex; j++)
+            if (lastUse[live[j]] <= i)
+                freeTemp(tempOf[live[j]]);
+            else
+                live[k++] = live[j];
+        livex = k;
+        
+        toTemp(i);
+        live[livex++] = i;
+    }
+    
+    // the slots belong to the allocation, not to emission.  Temps
+    // taken while emitting are new ones, since a slot in the pool
+    // may still be assigned to an earlier interval.
+    for (i = 0; i < irx; i++)
+        tempOf[i] = -1;
+    freeTempx = 0;
+}
+//-----------------------------------------
+// emit an instruction of the register backend, counting operands
+// that are memory words rather than registers
+void emitOperand(char *op, char *opnd)
+{
+    operandOps++;
+    if (opnd[0] != '%')
+        memoryOps++;
+    emitInstruction2(op, opnd);
+}
+//-----------------------------------------
+// kind of value v for matching: IR_LEAF if it is already in memory.
+// The value being computed (root) is matched by its opcode.
+int nodeKind(int v, int root)
+{
+    if (!root && loc[v])
+        return IR_LEAF;
+    return ir[v].op;
+}
+//-----------------------------------------
+// memory word or register holding leaf v
+char *nodeName(int v)
+{
+    if (loc[v])
+        return loc[v];
+    if (ir[v].op == IR_LOAD)
+        return symbol[ir[v].sym];
+    return constName(ir[v].con);
+}
+//-----------------------------------------
+// Instruction selection labeler.  Computes, bottom up, the cheapest
+// rule that puts value v in each nonterminal.  Only values computed
+// inside v's tree are descended into.  Chain rules are applied
+// until no cost improves.
+void label(int v, int root)
+{
+    int r, c, kind, changed;
+    RULE *rp;
+    
+    kind = nodeKind(v, root);
+    if (kind == IR_ADD || kind == IR_MULT)
+    {
+        label(ir[v].a, FALSE);
+        label(ir[v].b, FALSE);
+    }
+    
+    for (r = 0; r < NTCOUNT; r++)
+        nodeCost[v][r] = INFINITE;
+    
+    for (r = 0; r < RULECOUNT; r++)
+    {
+        rp = &rules[r];
+        if (rp -> op != kind)
+            continue;
+        if (rp -> small && (ir[v].con < 0 || ir[v].con > 4095))
+            continue;
+        c = rp -> cost;
+        if (rp -> left >= 0)
+            c += nodeCost[ir[v].a][rp -> left] +
+                 nodeCost[ir[v].b][rp -> right];
+        if (c < nodeCost[v][rp -> lhs])
+        {
+            nodeCost[v][rp -> lhs] = c;
+            nodeRule[v][rp -> lhs] = r;
+        }
+    }
+    
+    do
+    {
+        changed = FALSE;
+        for (r = 0; r < RULECOUNT; r++)
+        {
+            rp = &rules[r];
+            if (rp -> op != CHAIN)
+                continue;
+            c = rp -> cost + nodeCost[v][rp -> left];
+            if (c < nodeCost[v][rp -> lhs])
+            {
+                nodeCost[v][rp -> lhs] = c;
+                nodeRule[v][rp -> lhs] = r;
+                changed = TRUE;
+            }
+        }
+    } while (changed);
+}
+//-----------------------------------------
+// the instruction that reads the pending operands since mark has
+// been emitted: release their values and temps
+void release(int mark)
+{
+    while (pendingx > mark)
+    {
+        pendingx--;
+        if (pendingValue[pendingx] >= 0)
+            useDone(pendingValue[pendingx]);
+        else
+            freeTemp(pendingTemp[pendingx]);
+    }
+}
+//-----------------------------------------
+// emit the cheapest cover of value v that leaves it in nonterminal
+// nt.  Returns the operand naming v if nt is NT_MEM.  An operand
+// that is computed in ac is reduced after the one bound for
+// memory, so computing it cannot disturb the other.
+char *reduce(int v, int nt, int root)
+{
+    RULE *rp = &rules[nodeRule[v][nt]];
+    char *name = NULL, *left = NULL, *right = NULL;
+    char temp[20];
+    int mark = pendingx, t = -1;
+    
+    if (rp -> op == CHAIN)
+        name = reduce(v, rp -> left, root);
+    else if (rp -> left == NT_AC)
+    {
+        right = reduce(ir[v].b, rp -> right, FALSE);
+        left = reduce(ir[v].a, rp -> left, FALSE);
+    }
+    else if (rp -> left >= 0)
+    {
+        left = reduce(ir[v].a, rp -> left, FALSE);
+        right = reduce(ir[v].b, rp -> right, FALSE);
+    }
+    else if (!root)
+    {
+        // a leaf: this use is done once its reader is emitted
+        pendingValue[pendingx] = v;
+        pendingTemp[pendingx++] = -1;
+    }
+    
+    if (rp -> operand == OPND_NAME && rp -> lhs == NT_MEM)
+        name = nodeName(v);
+    if (!rp -> instr)
+        return name;
+    
+    switch(rp -> operand)
+    {
+        case OPND_NONE:
+            emitInstruction1(rp -> instr);
+            break;
+        case OPND_NAME:
+            emitInstruction2(rp -> instr, nodeName(v));
+            break;
+        case OPND_VALUE:
+            sprintf(temp, "%d", ir[v].con);
+            if (rp -> lhs != NT_STACK)
+                operandOps++;
+            emitInstruction2(rp -> instr, temp);
+            break;
+        case OPND_TEMP:
+            t = getTemp();
+            emitOperand(rp -> instr, tempName[t]);
+            break;
+        case OPND_MEM:
+            emitOperand(rp -> instr, name ? name : left ? left : right);
+            break;
+        case OPND_CONST:
+            sprintf(temp, "%d", rp -> left == NT_CONST ?
+                    ir[ir[v].a].con : ir[ir[v].b].con);
+            emitInstruction2(rp -> instr, temp);
+            break;
+    }
+    release(mark);
+    
+    if (t >= 0)
+    {
+        // read by the instruction that uses this operand
+        pendingValue[pendingx] = -1;
+        pendingTemp[pendingx++] = t;
+        return tempName[t];
+    }
+    return NULL;
+}
+//-----------------------------------------
+// emit code that leaves value v in nonterminal nt
+void genValue(int v, int nt, int root)
+{
+    label(v, root);
+    reduce(v, nt, root);
+}
+//-----------------------------------------
+// if an operand of the sum or product v is inAc, the value ac
+// holds, and the other operand needs no code to be named, compute v
+// as ac + other (or ac * other) rather than loading the operand
+// again.  TRUE if it was.
+int genFromAc(int v, int inAc)
+{
+    int other, mark = pendingx;
+    char *name;
+    
+    if (inAc < 0 || (ir[v].a != inAc && ir[v].b != inAc))
+        return FALSE;
+    other = ir[v].a == inAc ? ir[v].b : ir[v].a;
+    label(other, FALSE);
+    if (nodeCost[other][NT_MEM] != 0)
+        return FALSE;
+    name = reduce(other, NT_MEM, FALSE);
+    emitOperand(ir[v].op == IR_ADD ? "add" : "mult", name);
+    release(mark);
+    useDone(inAc);
+    return TRUE;
+}
+//-----------------------------------------
+// register backend: every value is computed in ac and kept in a
+// register or in memory (a variable, constant pool entry, or @t
+// temp).  Sums and products used once by another are computed in
+// ac as part of their user's tree.  inAc is the value ac holds, so
+// a value stored right after it is computed is not loaded again.
+void genRegister(void)
+{
+    int i, inAc = -1;
+    
+    fprintf(outFile, "!r\n"); //using register instruction set
+    computeUses();
+    if (optLevel >= 1)
+        allocateRegisters();
+    
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead)
+            continue;
+        switch(ir[i].op)
+        {
+            case IR_SOURCE:
+                fprintf(outFile, "; %s", ir[i].text);
+                break;
+            case IR_LOAD:
+                // the variable itself holds the value unless it is
+                // assigned again before the value's last use
+                if (directStore[i] >= 0)
+                {
+                    loc[i] = symbol[ir[directStore[i]].sym];
+                    emitOperand("ld", symbol[ir[i].sym]);
+                    emitOperand("st", loc[i]);
+                    inAc = i;
+                }
+                else if (needsTemp(i))
+                {
+                    if (!loc[i])
+                        toTemp(i);
+                    emitOperand("ld", symbol[ir[i].sym]);
+                    emitOperand("st", loc[i]);
+                    inAc = i;
+                }
+                break;
+            case IR_ADD:
+            case IR_MULT:
+                if (uses[i] == 0 || interior[i])
+                    break;
+                
+                // operands are read before the result is stored, so
+                // the result may reuse an operand's temp
+                if (!genFromAc(i, inAc))
+                    genValue(i, NT_AC, TRUE);
+                inAc = i;
+                if (directStore[i] >= 0)
+                {
+                    // printed from ac: nothing to store
+                    if (ir[directStore[i]].op != IR_STORE)
+                        break;
+                    loc[i] = symbol[ir[directStore[i]].sym];
+                }
+                else if (!loc[i])
+                    toTemp(i);
+                emitOperand("st", loc[i]);
+                break;
+            case IR_STORE:
+                // already stored if the value was computed into it.
+                // Otherwise x = x + 1, whose old or new value is
+                // still needed elsewhere, is st to its temp and then
+                // st to x, with no ld in between.
+                if (directStore[ir[i].a] == i)
+                    useDone(ir[i].a);
+                else
+                {
+                    if (inAc == ir[i].a)
+                        useDone(ir[i].a);
+                    else
+                        genValue(ir[i].a, NT_AC, FALSE);
+                    emitOperand("st", symbol[ir[i].sym]);
+                    inAc = ir[i].a;
+                }
+                break;
+            case IR_PRINTLN:
+            case IR_PRINT:
+                if (ir[ir[i].a].op == IR_CONST)
+                {
+                    addOutput(i);
+                    useDone(ir[i].a);
+                    break;
+                }
+                flushOutput();
+                if (directStore[ir[i].a] == i || inAc == ir[i].a)
+                    useDone(ir[i].a);
+                else
+                    genValue(ir[i].a, NT_AC, FALSE);
+                inAc = -1;
+                emitInstruction1("dout");
+                if (ir[i].op == IR_PRINTLN)
+                {
+                    emitInstruction2("pc", "'\\n'");
+                    emitInstruction1("aout");
+                }
+                break;
+        }
+    }
+}
+//-----------------------------------------
+// stack backend.  A value used more than once, or whose operands
+// could be changed by a store before its use, is stored where it
+// is defined: in the variable it is assigned to if that variable
+// keeps it until its last use (so x = x + 1 is pc x, p x, awc 1,
+// stav), else in an @t temp.  Other sums and products are computed
+// inside their user's tree.  A variable is pushed directly unless
+// it is assigned before the use.
+void genStack(void)
+{
+    int i, t, s;
+    
+    computeUses();
+    
+    for (i = 0; i < irx; i++)
+    {
+        if (ir[i].dead)
+            continue;
+        switch(ir[i].op)
+        {
+            case IR_SOURCE:
+                fprintf(outFile, "; %s", ir[i].text);
+                break;
+            case IR_LOAD:
+            case IR_ADD:
+            case IR_MULT:
+                if (ir[i].op == IR_LOAD ?
+                    storeBetween(ir[i].sym, i, lastUse[i]) :
+                    uses[i] > 0 && !interior[i])
+                {
+                    s = directStore[i];
+                    if (s >= 0 && ir[s].op == IR_STORE)
+                        loc[i] = symbol[ir[s].sym];
+                    else
+                    {
+                        t = getTemp();
+                        tempOf[i] = t;
+                        loc[i] = tempName[t];
+                    }
+                    emitInstruction2("pc", loc[i]);
+                    genValue(i, NT_STACK, TRUE);
+                    emitInstruction1("stav");
+                }
+                break;
+            case IR_STORE:
+                if (directStore[ir[i].a] == i && loc[ir[i].a] ==
+                    symbol[ir[i].sym])
+                {
+                    useDone(ir[i].a);
+                    break;
+                }
+                emitInstruction2("pc", symbol[ir[i].sym]);
+                genValue(ir[i].a, NT_STACK, FALSE);
+                emitInstruction1("stav");
+                break;
+            case IR_PRINTLN:
+            case IR_PRINT:
+                if (ir[ir[i].a].op == IR_CONST)
+                {
+                    addOutput(i);
+                    useDone(ir[i].a);
+                    break;
+                }
+                flushOutput();
+                genValue(ir[i].a, NT_STACK, FALSE);
+                emitInstruction1("dout");
+                if (ir[i].op == IR_PRINTLN)
+                {
+                    emitInstruction2("pc", "'\\n'");
+                    emitInstruction1("aout");
+                }
+                break;
+        }
+    }
+}
+//-----------------------------------------
+// add the cost of instruction op, whose operand is opnd (NULL if
+// none), to the cost of the code
+void trackCost(char *op, char *opnd)
+{
+    int i;
+    
+    for (i = 0; i < COSTCOUNT; i++)
+        if (!strcmp(op, costs[i].op))
+        {
+            codeWords += costs[i].words;
+            if (!opnd)
+                codeCycles += stackTarget ? costs[i].stack : costs[i].ac;
+            else if (opnd[0] == '%')
+                codeCycles += costs[i].reg;
+            else
+                codeCycles += costs[i].memory;
+            break;
+        }
+}
+//-----------------------------------------
+// emit one-operand instruction
+void emitInstruction1(char *op)
+{
+    trackCost(op, NULL);
+    fprintf(outFile, "          %-4s\n", op);
+}
+//-----------------------------------------
+// emit two-operand instruction
+// function overloading not supported by C
+void emitInstruction2(char *op, char *opnd)
+{
+    trackCost(op, opnd);
+    fprintf(outFile,
+            "          %-4s      %s\n", op,opnd);
+}
+//-----------------------------------------
+// a word, or a string of one word per character and a terminator
+void emitdw(char *label, char *value)
+{
+    char temp[80], *p;
+    
+    codeWords++;
+    if (value[0] == '"')
+        for (p = value + 1; p[1]; p++)
+            if (*p != '\\')
+                codeWords++;
+    strcpy(temp, label);
+    strcat(temp, ":");
+    
+    fprintf(outFile,
+            "%-9s dw        %s\n", temp, value);
+}
+//-----------------------------------------
+// print the pending constant text with one sout
+void flushOutput(void)
+{
+    char label[20];
+    
+    if (!outText[0])
+        return;
+    sprintf(label, "@str%d", stringCount);
+    stringText[stringCount++] = strdup(outText);
+    emitInstruction2("pc", label);
+    emitInstruction1("sout");
+    outText[0] = '\0';
+}
+//-----------------------------------------
+// print or println instruction i prints a constant: add its text
+// to the pending output
+void addOutput(int i)
+{
+    char text[20];
+    
+    sprintf(text, ir[i].op == IR_PRINTLN ? "%d\n" : "%d",
+            ir[ir[i].a].con);
+    if (strlen(outText) + strlen(text) > MAX)
+        flushOutput();
+    strcat(outText, text);
+    coalescedCount++;
+}
+//-----------------------------------------
+void endCode(void)
+{
+    int i;
+    char value[2 * MAX + 20], *p, *q;
+    
+    flushOutput();
+    trackCost("halt", NULL);
+    emitInstruction1("\n          halt\n");
+    
+    // emit dw for each symbol in the symbol table
+    for (i=0; i < symbolx; i++) {
+        if(needsDW[i] == TRUE)
+             emitdw(symbol[i], dwValue[i]);
+    }
+    
+    // and for each temp
+    for (i = 0; i < tempCount; i++)
+        emitdw(tempName[i], "0");
+    
+    // constant pool in order of value
+    for (i = 0; i < 65536; i++)
+        if (poolEntry[i])
+        {
+            sprintf(value, "%d", i - 32768);
+            emitdw(poolEntry[i], value);
+        }
+    
+    // strings, with newlines written \n
+    for (i = 0; i < stringCount; i++)
+    {
+        q = value;
+        *q++ = '"';
+        for (p = stringText[i]; *p; p++)
+            if (*p == '\n')
+            {
+                *q++ = '\\';
+                *q++ = 'n';
+            }
+            else
+                *q++ = *p;
+        *q++ = '"';
+        *q = '\0';
+        sprintf(outText, "@str%d", i);
+        emitdw(outText, value);
+    }
+}
+//-----------------------------------------
 
+
+void assign(int left, int expVal) {
+    int s = irEmit(IR_STORE, expVal, -1);
+    ir[s].sym = left;
+    current[left] = expVal;
+}
+
+void println(int expVal) {
+    irEmit(IR_PRINTLN, expVal, -1);
+}
+int factor(void)
+{
+    TOKEN *t;
+    int index;
+    
+    // token trace, left out of the messages of a library compile
+    if (!context)
+        printf("%s ", currentToken -> image);
     switch(currentToken -> kind)
     {
+        case UNSIGNED:
+            t = currentToken;
+            consume(UNSIGNED);
+            return irConst(atoi(t -> image));
+
         case PLUS:
             consume(PLUS);
-            right = term(); //returns next term (since left is current term)
-            temp = add(left, right);
-            expVal = termList(temp);
-            return expVal;
-            break;
-        case RIGHTPAREN:
-        case SEMICOLON:
-            return left;
-            break;
+            t = currentToken;
+            consume(UNSIGNED);
+            return irConst(atoi(t -> image));
+
+        case MINUS:
+            consume(MINUS);
+            t = currentToken;
+            consume(UNSIGNED);
+            return irConst(-atoi(t -> image));
+
+        case ID:
+            t = currentToken;
+            consume(ID);
+            return useVariable(t -> image);
+
+        case LEFTPAREN:
+            consume(LEFTPAREN);
+            index = expr();
+            consume(RIGHTPAREN);
+            return index;
+
         default:
             displayErrorLoc();
-            printf(
-                   "Scanning %s, expecting \"+\", \")\", or \";\"\n",
-                   currentToken -> image);
+            fprintf(msgFile, "Scanning %s, expecting factor\n",
+                    currentToken -> image);
             abend();
     }
+    return -1;
+}
+//-----------------------------------------
+int factorList(int left) {
+int right,temp, termVal;
 
-    /*
+
+    if (currentToken -> kind == TIMES) {
+        consume(TIMES);
+        right = factor();
+        temp = mult(left,right);
+        termVal = factorList(temp);
+        return termVal;
+    }
+
+    else {
+        return left;
+    }
+}
+//-----------------------------------------
+int term(void)
+{
+    int left, termVal;
+    left = factor();
+    termVal = factorList(left);
+    return termVal;
+}
+//-----------------------------------------
+int termList(int left)
+{
+    int right, temp, expVal;
 
     switch(currentToken -> kind)
     {
@@ -644,32 +1881,20 @@ int termList(int left)
             right = term(); //returns next term (since left is current term)
             temp = add(left, right);
             expVal = termList(temp);
-            term();
-            emitInstruction1("add");
             return expVal;
             break;
-            
-        case MINUS:
-            
-            consume(MINUS);
-            term();
-            emitInstruction1("sub");
-            termList();
-            break;
-            
         case RIGHTPAREN:
         case SEMICOLON:
-            ;
+            return left;
             break;
         default:
             displayErrorLoc();
-            printf(
-                   "Scanning %s, expecting \"+\", \")\", or \";\"\n",
-                   currentToken -> image);
+            fprintf(msgFile,
+                    "Scanning %s, expecting \"+\", \")\", or \";\"\n",
+                    currentToken -> image);
             abend();
     }
-
-    */
+    return -1;
 }
 
 //-----------------------------------------
@@ -712,8 +1937,7 @@ void printlnStatement(void)
 void printStatement(void) {
     consume(PRINT);
     consume(LEFTPAREN);
-    expr();
-    emitInstruction1("dout");
+    irEmit(IR_PRINT, expr(), -1);
 
     consume(RIGHTPAREN);
     consume(SEMICOLON);
@@ -742,14 +1966,22 @@ void statement(void)
             printlnStatement();
             break;
             
- 
+        case PRINT:
+            printStatement();
+            break;
             
-        
+        case SEMICOLON:
+            nullStatement();
+            break;
+            
+        case LEFTBRACKET:
+            compoundStatement();
+            break;
             
         default:
             displayErrorLoc();
-            printf("Scanning %s, expecting statement\n",
-                   currentToken -> image);
+            fprintf(msgFile, "Scanning %s, expecting statement\n",
+                    currentToken -> image);
             abend();
     }
 }
@@ -785,19 +2017,152 @@ void statementList(void)
             break;
         default:
             displayErrorLoc();
-            printf(
-                   "Scanning %s, expecting statement or end of file\n",
-                   currentToken -> image);
+            fprintf(msgFile,
+                    "Scanning %s, expecting statement or end of file\n",
+                    currentToken -> image);
             abend();
     }
 }
 //-----------------------------------------
 
 
+// clear what code generation leaves behind, so the program can be
+// lowered more than once
+void resetBackend(void)
+{
+    int i;
+    
+    for (i = 0; i < irx; i++)
+        loc[i] = NULL;
+    for (i = 0; i < 65536; i++)
+    {
+        free(poolEntry[i]);
+        poolEntry[i] = NULL;
+    }
+    for (i = 0; i < tempCount; i++)
+        free(tempName[i]);
+    for (i = 0; i < stringCount; i++)
+        free(stringText[i]);
+    poolSize = poolLookups = poolHits = 0;
+    tempCount = freeTempx = pendingx = 0;
+    stringCount = coalescedCount = 0;
+    outText[0] = '\0';
+    operandOps = memoryOps = 0;
+    codeCycles = codeWords = 0;
+}
+//-----------------------------------------
+// lower the optimized IR with the chosen instruction set
+void generate(void)
+{
+    resetBackend();
+    if (stackTarget)
+        genStack();
+    else
+        genRegister();
+    endCode();
+}
+//-----------------------------------------
+// --auto: lower the program both ways into memory and keep the
+// instruction set whose code the cost model finds cheaper: fewer
+// cycles, then fewer words.  !r selects the set for a whole
+// program, so the choice is made per program.
+void chooseTarget(void)
+{
+    FILE *out = outFile;
+    char *text;
+    size_t size;
+    int cycles[2], words[2], t;
+    
+    for (t = 0; t < 2; t++)
+    {
+        stackTarget = t;
+        outFile = open_memstream(&text, &size);
+        if (!outFile)
+        {
+            fprintf(msgFile, "System error: cannot buffer code\n");
+            outFile = out;
+            abend();
+        }
+        generate();
+        fclose(outFile);
+        free(text);
+        cycles[t] = codeCycles;
+        words[t] = codeWords;
+    }
+    outFile = out;
+    
+    stackTarget = cycles[1] < cycles[0] ||
+                  (cycles[1] == cycles[0] && words[1] < words[0]);
+    fprintf(msgFile,
+            "\nauto: register code (%d registers) %d cycles, %d words\n",
+            optLevel >= 1 ? numRegs : 0, cycles[0], words[0]);
+    fprintf(msgFile, "auto: stack code %d cycles, %d words\n",
+            cycles[1], words[1]);
+    t = stackTarget;
+    if (cycles[0] != cycles[1])
+        fprintf(msgFile, "auto: %s code chosen, %d cycles fewer\n",
+                t ? "stack" : "register", cycles[!t] - cycles[t]);
+    else
+        fprintf(msgFile,
+                "auto: %s code chosen, same cycles and %d words fewer\n",
+                t ? "stack" : "register", words[!t] - words[t]);
+}
+//-----------------------------------------
+// --stats: memory operands of the register code lowered into memory
+// with no registers, the count the allocation is measured against
+int unallocatedOps(void)
+{
+    FILE *out = outFile;
+    char *text;
+    size_t size;
+    int regs = numRegs;
+    
+    numRegs = 0;
+    outFile = open_memstream(&text, &size);
+    if (!outFile)
+    {
+        fprintf(msgFile, "System error: cannot buffer code\n");
+        outFile = out;
+        abend();
+    }
+    generate();
+    fclose(outFile);
+    free(text);
+    outFile = out;
+    numRegs = regs;
+    return memoryOps;
+}
+//-----------------------------------------
 void program(void)
 {
+    int before = 0;
+    
     statementList();
-    endCode();
+    runPasses();
+    if (autoTarget)
+        chooseTarget();
+    if (stats && !stackTarget)
+        before = unallocatedOps();
+    generate();
+    
+    if (stats && !stackTarget)
+        fprintf(msgFile, "\nmemory operations: %d of %d operands "
+                "(%d without register allocation)\n",
+                memoryOps, operandOps, before);
+    if (stats)
+    {
+        fprintf(msgFile, "temps: %d\n", tempCount);
+        fprintf(msgFile,
+                "constant pool: %d entries, %d of %d lookups hit",
+                poolSize, poolHits, poolLookups);
+        if (poolLookups > 0)
+            fprintf(msgFile, " (%.1f%%)", 100.0 * poolHits / poolLookups);
+        fprintf(msgFile, "\n");
+        fprintf(msgFile, "output: %d print statements by %d sout\n",
+                coalescedCount, stringCount);
+        fprintf(msgFile, "cost: %d cycles, %d words\n",
+                codeCycles, codeWords);
+    }
 }
 //-----------------------------------------
 void parse(void)
@@ -806,21 +2171,518 @@ void parse(void)
     program();   // program is start symbol for grammar
 }
 //-----------------------------------------
+// free the tokens and IR of the last compile and restart the
+// tokenizer, so another program can be compiled in this process
+void resetCompiler(void)
+{
+    TOKEN *t, *next;
+    int i;
+    
+    for (t = firstToken; t; t = next)
+    {
+        next = t -> next;
+        if (t -> kind != END)        // <END> image is not allocated
+            free(t -> image);
+        free(t);
+    }
+    firstToken = currentToken = previousToken = NULL;
+    
+    resetBackend();
+    for (i = 0; i < irx; i++)
+        free(ir[i].text);
+    irx = symbolx = 0;
+    
+    currentChar = '\n';
+    currentLineNumber = currentColumnNumber = 0;
+}
+//-----------------------------------------
+void writeHeader(void)
+{
+    time(&timer);     // get time
+    fprintf(outFile, "; Anthony J. Dos Reis    %s",
+            asctime(localtime(&timer)));
+    fprintf(outFile, "; Output from S2 compiler\n");
+}
+//-----------------------------------------
+// Library entry point; see R1.h.  The globals are reset by each
+// call, so calls may follow one another but not overlap.
+int compile(const char *src, size_t len, OPTIONS *options,
+            char **code, size_t *codeSize, char **messages)
+{
+    CONTEXT c;
+    int failed;
+    
+    resetCompiler();
+    optLevel = options -> optLevel;
+    stackTarget = options -> stackTarget;
+    autoTarget = options -> autoTarget;
+    numRegs = options -> numRegs;
+    stats = options -> stats;
+    timePasses = options -> timePasses;
+    
+    *code = *messages = NULL;
+    *codeSize = 0;
+    msgFile = open_memstream(&c.messages, &c.messagesSize);
+    outFile = open_memstream(&c.code, &c.codeSize);
+    inFile = fmemopen((void *)src, len, "r");
+    if (!msgFile || !outFile || !inFile)
+    {
+        if (msgFile)
+            fclose(msgFile);
+        if (outFile)
+            fclose(outFile);
+        if (inFile)
+            fclose(inFile);
+        free(c.messages);
+        free(c.code);
+        msgFile = stdout;
+        return 1;
+    }
+    
+    context = &c;
+    failed = setjmp(c.failure);
+    if (!failed)
+    {
+        writeHeader();
+        parse();
+        fclose(inFile);
+        fclose(outFile);
+    }
+    context = NULL;
+    fclose(msgFile);
+    msgFile = stdout;
+    
+    *messages = c.messages;
+    if (failed)
+        free(c.code);
+    else
+    {
+        *code = c.code;
+        *codeSize = c.codeSize;
+    }
+    return failed;
+}
+//-----------------------------------------
+// --run.  The .a file just written is decoded once into an array of
+// RUNINST whose operands point at the words they name: a data word,
+// a constant, or a register.  ldc and ld are then the same
+// instruction.  Runs of a load, an add or mult, and a store are
+// fused into superinstructions, as are the pc that feeds an aout or
+// sout and the instruction it feeds.  R1 code has no jumps, so any
+// run can be fused.
+#define RUN_LD 0            // ac = *a
+#define RUN_ST 1            // *a = ac
+#define RUN_ADD 2           // ac += *a
+#define RUN_MULT 3          // ac *= *a
+#define RUN_LDADD 4         // ac = *a + *b
+#define RUN_LDMULT 5        // ac = *a * *b
+#define RUN_ADDST 6         // ac += *a; *b = ac
+#define RUN_MULTST 7        // ac *= *a; *b = ac
+#define RUN_LDADDST 8       // ac = *a + *b; *c = ac
+#define RUN_LDMULTST 9      // ac = *a * *b; *c = ac
+#define RUN_LDST 10         // ac = *a; *b = ac
+#define RUN_DOUT 11         // print ac
+#define RUN_PUSH 12         // push *a (p, pc, pwc)
+#define RUN_AWC 13          // top += *a
+#define RUN_SADD 14         // stack add
+#define RUN_SMULT 15        // stack mult
+#define RUN_STAV 16         // pop value and address, store
+#define RUN_SDOUT 17        // pop and print
+#define RUN_AOUT 18         // pop and print character
+#define RUN_SOUT 19         // pop address and print string
+#define RUN_OUTCHAR 20      // print character *a (pc; aout)
+#define RUN_OUTSTR 21       // print string at address *a (pc; sout)
+#define RUN_HALT 22
+
+typedef struct
+{
+    int op;
+    int *a, *b, *c;     // operand words
+    int count;          // instructions of the .a file it stands for
+} RUNINST;
+
+RUNINST runCode[RUNSIZE];
+int runCodex;
+int cell[RUNSIZE];            // data words, then constants
+int cellx;
+char *cellLabel[RUNSIZE];     // dw label of each data word
+int runRegs[NUMREGS];
+int runStack[RUNSIZE];
+
+//-----------------------------------------
+// Split line into its label, opcode, and operand, each an empty
+// string if absent.  A ; outside quotes starts a comment.
+void splitRunLine(char *line, char *label, char *op, char *operand)
+{
+    char *p, *q, quote = 0;
+    
+    for (p = line; *p; p++)
+    {
+        if (quote)
+        {
+            if (*p == '\\' && p[1])
+                p++;
+            else if (*p == quote)
+                quote = 0;
+        }
+        else if (*p == '\'' || *p == '"')
+            quote = *p;
+        else if (*p == ';' || *p == '\n')
+            break;
+    }
+    while (p > line && isspace(p[-1]))
+        p--;
+    *p = '\0';
+    
+    label[0] = op[0] = operand[0] = '\0';
+    p = line;
+    if (*p && !isspace(*p))
+    {
+        for (q = label; *p && *p != ':' && !isspace(*p); )
+            *q++ = *p++;
+        *q = '\0';
+        if (*p == ':')
+            p++;
+    }
+    while (isspace(*p))
+        p++;
+    for (q = op; *p && !isspace(*p); )
+        *q++ = *p++;
+    *q = '\0';
+    while (isspace(*p))
+        p++;
+    strcpy(operand, p);
+}
+//-----------------------------------------
+// a new data word holding v
+int *runConstant(int v)
+{
+    if (cellx >= RUNSIZE)
+    {
+        printf("System error: --run data overflow\n");
+        abend();
+    }
+    cell[cellx] = wrap16(v);
+    return &cell[cellx++];
+}
+//-----------------------------------------
+// the word operand s names: a register, a data word, or a constant
+int *runOperand(char *s)
+{
+    int i;
+    
+    if (s[0] == '%')
+        return &runRegs[atoi(s + 2) % NUMREGS];
+    if (s[0] == '\'')
+        return runConstant(s[1] != '\\' ? s[1] : s[2] == 'n' ? '\n' :
+                           s[2] == 't' ? '\t' : s[2]);
+    if (isdigit(s[0]) || s[0] == '-' || s[0] == '+')
+        return runConstant(atoi(s));
+    for (i = 0; i < cellx; i++)
+        if (cellLabel[i] && !strcmp(s, cellLabel[i]))
+            return &cell[i];
+    printf("Runtime error: undefined label %s\n", s);
+    abend();
+    return NULL;
+}
+//-----------------------------------------
+// decode file name into runCode.  The dw lines are read first, so
+// every label is known when the instructions are decoded.
+void runDecode(char *name)
+{
+    FILE *f;
+    char line[2 * MAX + 40], label[2 * MAX + 40], op[MAX];
+    char operand[2 * MAX + 40], *p;
+    int pass, registerSet = FALSE, k;
+    RUNINST *r;
+    
+    f = fopen(name, "r");
+    if (!f)
+    {
+        printf("Error: Cannot open %s\n", name);
+        abend();
+    }
+    
+    for (pass = 1; pass <= 2; pass++)
+    {
+        rewind(f);
+        while (fgets(line, sizeof(line), f))
+        {
+            if (line[0] == '!')
+            {
+                registerSet = TRUE;
+                continue;
+            }
+            splitRunLine(line, label, op, operand);
+            if (!op[0])
+                continue;
+            
+            if (!strcmp(op, "dw"))
+            {
+                if (pass == 2)
+                    continue;
+                cellLabel[cellx] = strdup(label);
+                if (operand[0] != '"')
+                {
+                    runConstant(atoi(operand));
+                    continue;
+                }
+                for (p = operand + 1; *p && *p != '"'; p++)
+                    if (*p == '\\' && p[1])
+                    {
+                        p++;
+                        runConstant(*p == 'n' ? '\n' : *p);
+                    }
+                    else
+                        runConstant(*p);
+                runConstant(0);
+                continue;
+            }
+            if (pass == 1)
+                continue;
+            
+            if (runCodex >= RUNSIZE)
+            {
+                printf("System error: --run code overflow\n");
+                abend();
+            }
+            r = &runCode[runCodex++];
+            r -> count = 1;
+            r -> a = r -> b = r -> c = NULL;
+            if (!strcmp(op, "ld") || !strcmp(op, "ldc"))
+                r -> op = RUN_LD;
+            else if (!strcmp(op, "st"))
+                r -> op = RUN_ST;
+            else if (!strcmp(op, "add"))
+                r -> op = operand[0] ? RUN_ADD : RUN_SADD;
+            else if (!strcmp(op, "mult"))
+                r -> op = operand[0] ? RUN_MULT : RUN_SMULT;
+            else if (!strcmp(op, "p") || !strcmp(op, "pwc"))
+                r -> op = RUN_PUSH;
+            else if (!strcmp(op, "pc"))
+            {
+                // pc pushes the address of a label, else the value
+                r -> op = RUN_PUSH;
+                r -> a = runOperand(operand);
+                if (r -> a >= cell && r -> a < cell + cellx &&
+                    cellLabel[r -> a - cell])
+                    r -> a = runConstant(r -> a - cell);
+            }
+            else if (!strcmp(op, "awc"))
+                r -> op = RUN_AWC;
+            else if (!strcmp(op, "stav"))
+                r -> op = RUN_STAV;
+            else if (!strcmp(op, "dout"))
+                r -> op = registerSet ? RUN_DOUT : RUN_SDOUT;
+            else if (!strcmp(op, "aout"))
+                r -> op = RUN_AOUT;
+            else if (!strcmp(op, "sout"))
+                r -> op = RUN_SOUT;
+            else if (!strcmp(op, "halt"))
+                r -> op = RUN_HALT;
+            else
+            {
+                printf("Runtime error: unknown instruction %s\n", op);
+                abend();
+            }
+            if (operand[0] && !r -> a)
+                r -> a = runOperand(operand);
+        }
+    }
+    fclose(f);
+    
+    // running off the end stops the program
+    runCode[runCodex].op = RUN_HALT;
+    runCode[runCodex].count = 0;
+    
+    // only dw labels name data; a data word without one is a
+    // constant, and the labels are not needed after decoding
+    for (k = 0; k < cellx; k++)
+        cellLabel[k] = NULL;
+}
+//-----------------------------------------
+// fuse runs of runCode into superinstructions.  Returns the number
+// of instructions removed.
+int runFuse(void)
+{
+    RUNINST *r, *s;
+    int i, j, op;
+    
+    for (i = j = 0; i < runCodex; j++)
+    {
+        r = &runCode[i];
+        s = &runCode[j];
+        op = r -> op;
+        *s = *r;
+        if (op == RUN_LD && i + 2 < runCodex &&
+            (r[1].op == RUN_ADD || r[1].op == RUN_MULT) &&
+            r[2].op == RUN_ST)
+        {
+            s -> op = r[1].op == RUN_ADD ? RUN_LDADDST : RUN_LDMULTST;
+            s -> b = r[1].a;
+            s -> c = r[2].a;
+            s -> count = 3;
+            i += 3;
+        }
+        else if (op == RUN_LD && i + 1 < runCodex &&
+                 (r[1].op == RUN_ADD || r[1].op == RUN_MULT))
+        {
+            s -> op = r[1].op == RUN_ADD ? RUN_LDADD : RUN_LDMULT;
+            s -> b = r[1].a;
+            s -> count = 2;
+            i += 2;
+        }
+        else if ((op == RUN_ADD || op == RUN_MULT || op == RUN_LD) &&
+                 i + 1 < runCodex && r[1].op == RUN_ST)
+        {
+            s -> op = op == RUN_ADD ? RUN_ADDST : op == RUN_MULT ?
+                      RUN_MULTST : RUN_LDST;
+            s -> b = r[1].a;
+            s -> count = 2;
+            i += 2;
+        }
+        else if (op == RUN_PUSH && i + 1 < runCodex &&
+                 (r[1].op == RUN_AOUT || r[1].op == RUN_SOUT))
+        {
+            s -> op = r[1].op == RUN_AOUT ? RUN_OUTCHAR : RUN_OUTSTR;
+            s -> count = 2;
+            i += 2;
+        }
+        else
+            i++;
+    }
+    runCode[j] = runCode[runCodex];
+    i = runCodex - j;
+    runCodex = j;
+    return i;
+}
+//-----------------------------------------
+// run the decoded program.  Returns the number of instructions of
+// the .a file executed; *dispatches is set to the number of
+// RUNINST executed.
+long runExecute(long *dispatches)
+{
+    RUNINST *r;
+    int ac = 0, *sp = runStack, i;
+    long executed = 0;
+    
+    *dispatches = 0;
+    for (r = runCode; ; r++)
+    {
+        executed += r -> count;
+        (*dispatches)++;
+        switch(r -> op)
+        {
+            case RUN_LD:     ac = *r -> a;                        break;
+            case RUN_ST:     *r -> a = ac;                        break;
+            case RUN_ADD:    ac = wrap16(ac + *r -> a);           break;
+            case RUN_MULT:   ac = wrap16(ac * *r -> a);           break;
+            case RUN_LDADD:  ac = wrap16(*r -> a + *r -> b);      break;
+            case RUN_LDMULT: ac = wrap16(*r -> a * *r -> b);      break;
+            case RUN_ADDST:  *r -> b = ac = wrap16(ac + *r -> a); break;
+            case RUN_MULTST: *r -> b = ac = wrap16(ac * *r -> a); break;
+            case RUN_LDADDST:
+                *r -> c = ac = wrap16(*r -> a + *r -> b);
+                break;
+            case RUN_LDMULTST:
+                *r -> c = ac = wrap16(*r -> a * *r -> b);
+                break;
+            case RUN_LDST:   *r -> b = ac = *r -> a;              break;
+            case RUN_DOUT:   printf("%d", ac);                    break;
+            case RUN_PUSH:   *sp++ = *r -> a;                     break;
+            case RUN_AWC:    sp[-1] = wrap16(sp[-1] + *r -> a);   break;
+            case RUN_SADD:   sp--; sp[-1] = wrap16(sp[-1] + *sp); break;
+            case RUN_SMULT:  sp--; sp[-1] = wrap16(sp[-1] * *sp); break;
+            case RUN_STAV:
+                sp -= 2;
+                cell[sp[0] & (RUNSIZE - 1)] = sp[1];
+                break;
+            case RUN_SDOUT:  printf("%d", *--sp);                 break;
+            case RUN_AOUT:   putchar(*--sp);                      break;
+            case RUN_OUTCHAR: putchar(*r -> a);                   break;
+            case RUN_SOUT:
+            case RUN_OUTSTR:
+                i = r -> op == RUN_SOUT ? *--sp : *r -> a;
+                for (i &= RUNSIZE - 1; cell[i]; i = (i + 1) & (RUNSIZE - 1))
+                    putchar(cell[i]);
+                break;
+            case RUN_HALT:
+                return executed;
+        }
+    }
+}
+//-----------------------------------------
+// --run: execute the .a file just written
+void runFile(char *name)
+{
+    int decoded, fused;
+    long executed, dispatches;
+    
+    runDecode(name);
+    decoded = runCodex;
+    fused = runFuse();
+    printf("\n");
+    executed = runExecute(&dispatches);
+    fflush(stdout);
+    if (stats)
+        printf("\nrun: %d instructions decoded into %d (%d fused away); "
+               "%ld executed in %ld dispatches\n", decoded, runCodex,
+               fused, executed, dispatches);
+}
+//-----------------------------------------
+#ifndef R1_LIBRARY
 int main(int argc, char *argv[])
 {
+    int argx;
+    
+    msgFile = stdout;
     printf("S2 compiler written by Anthony J. Dos Reis\n");
-    if (argc != 2)
+    if (argc < 2)
     {
         printf("Incorrect number of command line args\n");
         exit(1);
     }
     
+    // options precede the file name
+    for (argx = 1; argx < argc - 1; argx++)
+    {
+        if (!strcmp(argv[argx], "-O0"))
+            optLevel = 0;
+        else if (!strcmp(argv[argx], "-O1"))
+            optLevel = 1;
+        else if (!strcmp(argv[argx], "-O2"))
+            optLevel = 2;
+        else if (!strcmp(argv[argx], "--time-passes"))
+            timePasses = TRUE;
+        else if (!strcmp(argv[argx], "--stack"))
+            stackTarget = TRUE;
+        else if (!strcmp(argv[argx], "--run"))
+            runProgram = TRUE;
+        else if (!strcmp(argv[argx], "--auto"))
+            autoTarget = TRUE;
+        else if (!strcmp(argv[argx], "--stats"))
+            stats = TRUE;
+        else if (!strncmp(argv[argx], "--regs=", 7))
+        {
+            numRegs = atoi(argv[argx] + 7);
+            if (numRegs < 0 || numRegs > NUMREGS)
+            {
+                printf("--regs must be 0 to %d\n", NUMREGS);
+                exit(1);
+            }
+        }
+        else
+        {
+            printf("Unknown option %s\n", argv[argx]);
+            exit(1);
+        }
+    }
     
     // build the input and output file names
-    strcpy(inFileName, argv[1]);
+    strcpy(inFileName, argv[argc - 1]);
     strcat(inFileName, ".s");       // append extension
     
-    strcpy(outFileName, argv[1]);
+    strcpy(outFileName, argv[argc - 1]);
     strcat(outFileName, ".a");      // append extension
     
     inFile = fopen(inFileName, "r");
@@ -836,15 +2698,7 @@ int main(int argc, char *argv[])
         exit(1);
     }
     
-    time(&timer);     // get time
-    fprintf(outFile, "; Anthony J. Dos Reis    %s",
-            asctime(localtime(&timer)));
-
-
-    fprintf(outFile,
-            "; Output from S2 compiler\n");
-    fprintf(outFile, "!r"); //using register instruction set 
-    
+    writeHeader();
     parse();
     
     fclose(inFile);
@@ -852,6 +2706,10 @@ int main(int argc, char *argv[])
     // must close output file or will lose most recent writes
     fclose(outFile);
     
+    if (runProgram)
+        runFile(outFileName);
+    
     // 0 return code means compile ended without error
     return 0;
-}
\ No newline at end of file
+}
+#endif
@@ -0,0 +1,32 @@
+// Library interface of the R1 compiler.  Build R1.c with
+// -DR1_LIBRARY to leave out its main.
+//
+// compile is serially reusable, not reentrant.  The compiler keeps
+// its state in globals that each call resets, so any number of
+// compiles may follow one another in a process, but calls must not
+// overlap: no recursion and no two threads compiling at once.
+#ifndef R1_H
+#define R1_H
+
+#include <stddef.h> // needed by size_t
+
+// Options of a compile, as set by the command line
+typedef struct
+{
+    int optLevel;           // 0 to 2, as -O0 to -O2
+    int stackTarget;        // --stack
+    int autoTarget;         // --auto
+    int numRegs;            // --regs=N, 0 to 8
+    int stats;              // --stats
+    int timePasses;         // --time-passes
+} OPTIONS;
+
+// Compiles the len bytes of src.  On return *code (the .a text, NULL
+// after an error) and *messages (the errors and reports the command
+// line compiler prints) are malloc'd strings the caller frees.
+// Returns 0, or 1 after a compile error or if the memory streams
+// cannot be opened.
+int compile(const char *src, size_t len, OPTIONS *options,
+            char **code, size_t *codeSize, char **messages);
+
+#endif
@@ -4,6 +4,7 @@
 #include <string.h> // needed by str functions
 #include <ctype.h>  // needed by isdigit, etc.
 #include <time.h>   // needed by asctime
+#include <sys/mman.h> // needed by mmap, mprotect
 
 // Constants
 
@@ -15,6 +16,7 @@
 // Sizes for arrays
 #define MAX 180            // size of string arrays
 #define SYMTABSIZE 1000    // symbol table size
+#define MAXDEPTH 100       // stack depths counted in the stack report
 
 #define END 0
 #define PRINTLN 1
@@ -33,13 +35,47 @@
 #define RIGHTBRACKET 14
 #define DIVIDE 15
 
+// Nonterminals for instruction selection
+#define NT_STACK 0         // value pushed on the stack
+#define NT_CONST 1         // constant
+#define NT_SMALL 2         // constant that fits the operand field of pc
+#define NTCOUNT 3
+
+#define CHAIN -1           // op of a chain rule
+#define INFINITE 1000000   // cost of an impossible cover
+
+// operand of the instruction a rule emits
+#define OPND_NONE 0
+#define OPND_SELF 1        // image of the node
+#define OPND_RIGHT 2       // image of the right child
+#define OPND_NEGRIGHT 3    // negated value of the right child
+
+// code the compiler emits
+#define TARGET_H1 0        // H1 stack instruction set, in name.a
+#define TARGET_X86 1       // x86-64 GNU assembler, in name-x86.s
+#define TARGET_JIT 2       // x86-64 machine code, run in memory
+#define TARGET_C 3         // C with 16-bit statics, in name-c.c
+#define TARGET_INTERPRET 4 // no code: statements run as parsed
+#define X86REGS 7          // registers for x86-64 expressions
+#define JITSIZE 1048576    // bytes of machine code for --jit
+#define OBJCODESIZE 65536  // instructions in an object file
+#define OBJMAGIC "H1O1"    // first bytes of an object file
+
 time_t timer;    // for asctime
 
 // Prototypes
 // Function definition or prototype must
 // precede function call so compiler can
 // check for correct type, number of args
-void expr(void);
+struct nodetype *expr(void);
+struct nodetype *reassociate(struct nodetype *n);
+int wrap16(int v);
+void emitX86(char *op, char *operands);
+void endX86(void);
+void jitString(char *s);
+void endJit(void);
+void cString(char *s);
+void endC(void);
 
 void statementList(void);
 
@@ -67,12 +103,105 @@ char *tokenImage[16] =
     
 };
 
-char inFileName[MAX], outFileName[MAX], inputLine[MAX];
+char inFileName[MAX], outFileName[MAX], mapFileName[MAX], inputLine[MAX];
 int debug = FALSE;
+int evaluate = FALSE;         // --evaluate: partially evaluate program
+int target = TARGET_H1;       // --x86, --jit, --c, --interpret
+char *comment = ";";          // starts a comment in the output
 
 char *symbol[SYMTABSIZE];     // symbol table
 int symbolx;                  // index into symbol table
 
+// evaluate mode: compile-time value of each symbol, valid when
+// known is TRUE.  Every variable starts as a known 0 (its dw).
+int known[SYMTABSIZE];
+int value[SYMTABSIZE];
+int evaluatedCount, residualCount;  // statements folded / kept
+int identityCount;            // x = x + 0 and the like, no code
+
+// Stack depth analysis.  Every instruction emitted updates depth,
+// the number of words the code pushes on the H1 stack, so the
+// depth of a statement is exact, not an estimate.
+int depth;                    // words on the stack at this point
+int statementDepth;           // most words during this statement
+int programDepth, deepestLine;
+int depthCount[MAXDEPTH + 1]; // statements reaching each depth
+int stackLimit = 0;           // --stack-limit=N, 0 if none
+int stackReport = FALSE;      // --stack-report
+int spillx;                   // @s temps used by this statement
+int spillCount;               // operands spilled to fit the limit
+
+// Coalesced output.  The text of a print or println whose value is
+// known at compile time is added to outText.  A run of such text is
+// printed by one sout when dynamic output, code that could stop the
+// program (a division), or the end of the program follows.
+char outText[MAX + 20];
+char *stringText[SYMTABSIZE]; // @str dw strings, emitted by endCode
+int stringCount;
+int coalescedCount;           // print/println statements in strings
+
+// --object: name.ho, the H1 code already assembled, in place of the
+// text of name.a.  The instructions and dw lines are recorded as
+// they are emitted and resolved by writeObject.  Opcodes are the
+// index in objOpName, the numbering the H1 interpreter uses.
+// The file, all fields little-endian:
+//   "H1O1"
+//   int32 codeCount, dataCount, symbolCount, hasLines
+//   codeCount int32 instructions: isLabel << 24 | op << 16 | operand
+//   dataCount int16 data words
+//   symbolCount symbols: int32 value, int32 isCode, name, 0 byte
+//   codeCount int32 source lines, if hasLines
+// --strip leaves out the symbols and the lines.  The line of an
+// instruction is that of the statement it was emitted for.
+int object = FALSE;           // --object
+int strip = FALSE;            // --strip
+
+// --line-map: name.map, one line "instruction line column" for each
+// H1 instruction, giving the start of the statement that produced
+// it.  Instructions are numbered from 0 in the order the H1
+// interpreter decodes them, which is the order they are emitted.
+FILE *mapFile;
+int lineMap = FALSE;          // --line-map
+int instructionCount;         // H1 instructions emitted
+int statementLine, statementColumn;  // statement being compiled
+
+char *objOpName[] =
+{
+    "p", "pc", "pwc", "awc", "stav", "add", "sub", "mult", "div",
+    "dout", "aout", "sout", "ja", "jz", "jnz", "jn", "jp", "jzop",
+    "jzon", "halt"
+};
+#define OBJOPCOUNT (int)(sizeof(objOpName) / sizeof(objOpName[0]))
+
+typedef struct
+{
+    int op;
+    char *operand;      // label or constant, NULL if none
+    int line;           // source line
+} OBJINSTR;
+
+OBJINSTR objCode[OBJCODESIZE];
+int objCodex;
+char *objLabel[2 * SYMTABSIZE];  // dw lines: symbols, then strings
+char *objValue[2 * SYMTABSIZE];
+int objAddress[2 * SYMTABSIZE];
+int objDatax;
+
+// words each instruction adds to the stack
+typedef struct
+{
+    char *op;
+    int effect;
+} EFFECT;
+
+EFFECT effects[] =
+{
+    {"p", 1}, {"pc", 1}, {"pwc", 1}, {"awc", 0},
+    {"add", -1}, {"sub", -1}, {"mult", -1}, {"div", -1},
+    {"stav", -2}, {"dout", -1}, {"aout", -1}, {"sout", -1}
+};
+#define EFFECTCOUNT (int)(sizeof(effects) / sizeof(effects[0]))
+
 //create new type named TOKEN
 typedef struct tokentype
 {
@@ -82,6 +211,49 @@ typedef struct tokentype
     struct tokentype *next;
 } TOKEN;
 
+// expressions are parsed into trees before code is emitted
+typedef struct nodetype
+{
+    int kind;           // UNSIGNED, ID, or operator token kind
+    char *image;        // image of literal or identifier
+    struct nodetype *left, *right;
+    int cost[NTCOUNT];  // cheapest cost of subtree in each nonterminal
+    int rule[NTCOUNT];  // rule giving that cost
+} NODE;
+
+// Instruction selection.  A rule rewrites a node of kind op whose
+// children are in nonterminals left and right into nonterminal lhs,
+// emitting instr.  A chain rule (op CHAIN) rewrites nonterminal left
+// into lhs.  Costs are H1 memory cycles: one per instruction word
+// fetched plus one per data or stack word read or written.  A new
+// instruction form is added by adding a rule here.
+typedef struct
+{
+    int lhs;            // nonterminal produced
+    int op;             // node kind matched, or CHAIN
+    int left, right;    // nonterminals of children, -1 for a leaf
+    int small;          // TRUE: constant must fit pc (0 to 4095)
+    int cost;
+    char *instr;        // NULL if rule emits nothing
+    int operand;        // OPND_ kind of instr's operand
+} RULE;
+
+RULE rules[] =
+{
+    {NT_CONST, UNSIGNED, -1,       -1,       FALSE, 0, NULL,   OPND_NONE},
+    {NT_SMALL, UNSIGNED, -1,       -1,       TRUE,  0, NULL,   OPND_NONE},
+    {NT_STACK, ID,       -1,       -1,       FALSE, 3, "p",    OPND_SELF},
+    {NT_STACK, CHAIN,    NT_CONST, -1,       FALSE, 3, "pwc",  OPND_SELF},
+    {NT_STACK, CHAIN,    NT_SMALL, -1,       FALSE, 2, "pc",   OPND_SELF},
+    {NT_STACK, PLUS,     NT_STACK, NT_STACK, FALSE, 4, "add",  OPND_NONE},
+    {NT_STACK, PLUS,     NT_STACK, NT_CONST, FALSE, 4, "awc",  OPND_RIGHT},
+    {NT_STACK, MINUS,    NT_STACK, NT_STACK, FALSE, 4, "sub",  OPND_NONE},
+    {NT_STACK, MINUS,    NT_STACK, NT_CONST, FALSE, 4, "awc",  OPND_NEGRIGHT},
+    {NT_STACK, TIMES,    NT_STACK, NT_STACK, FALSE, 4, "mult", OPND_NONE},
+    {NT_STACK, DIVIDE,   NT_STACK, NT_STACK, FALSE, 4, "div",  OPND_NONE}
+};
+#define RULECOUNT (int)(sizeof(rules) / sizeof(rules[0]))
+
 
 FILE *inFile, *outFile;     // file pointers
 
@@ -97,7 +269,10 @@ TOKEN *previousToken;
 void abend(void)
 {
     fclose(inFile);
-    fclose(outFile);
+    if (outFile)
+        fclose(outFile);
+    if (mapFile)
+        fclose(mapFile);
     exit(1);
 }
 //-----------------------------------------
@@ -108,7 +283,8 @@ void displayErrorLoc(void)
 }
 //-----------------------------------------
 // enter symbol into symbol table if not already there
-void enter(char *s)
+// returns index of symbol in symbol table
+int enter(char *s)
 {
     int i = 0;
     while (i < symbolx)
@@ -121,13 +297,20 @@ void enter(char *s)
     // if s is not in symbol table, then add it
     
     if (i == symbolx)
+    {
         if (symbolx < SYMTABSIZE)
+        {
             symbol[symbolx++] = s;
+            known[i] = TRUE;
+            value[i] = 0;
+        }
         else
         {
             printf("System error: symbol table overflow\n");
             abend();
         }
+    }
+    return i;
 }
 //-----------------------------------------
 void getNextChar(void)
@@ -141,7 +324,8 @@ void getNextChar(void)
         if (fgets(inputLine, sizeof(inputLine), inFile))
         {
             // output source line as comment
-            fprintf(outFile, "; %s", inputLine);
+            if (outFile)
+                fprintf(outFile, "%s %s", comment, inputLine);
             currentColumnNumber = 0;
             currentLineNumber++;
         }
@@ -299,10 +483,10 @@ TOKEN *getNextToken(void)
     // token trace appears as comments in output file
     
     // set debug to true to check tokenizer
-    if (debug)
+    if (debug && outFile)
         fprintf(outFile,
-                "; kd=%3d bL=%3d bC=%3d eL=%3d eC=%3d     im=%s\n",
-                t -> kind, t -> beginLine, t -> beginColumn,
+                "%s kd=%3d bL=%3d bC=%3d eL=%3d eC=%3d     im=%s\n",
+                comment, t -> kind, t -> beginLine, t -> beginColumn,
                 t -> endLine, t -> endColumn, t -> image);
     
     return t;     // return token to parser
@@ -382,9 +566,202 @@ TOKEN *getToken(int i)
     return t;
 }
 //-----------------------------------------
+// --object: record instruction op, whose operand is opnd or NULL
+void objInstruction(char *op, char *opnd)
+{
+    char name[MAX], *p;
+    int i;
+    
+    while (isspace(*op))         // halt comes with blank lines
+        op++;
+    for (p = name; *op && !isspace(*op); )
+        *p++ = *op++;
+    *p = '\0';
+    for (i = 0; i < OBJOPCOUNT; i++)
+        if (!strcmp(name, objOpName[i]))
+            break;
+    if (i == OBJOPCOUNT)
+    {
+        printf("System error: no opcode for %s\n", name);
+        abend();
+    }
+    if (objCodex >= OBJCODESIZE)
+    {
+        printf("System error: object code overflow\n");
+        abend();
+    }
+    objCode[objCodex].op = i;
+    objCode[objCodex].operand = opnd ? strdup(opnd) : NULL;
+    objCode[objCodex++].line = statementLine;
+}
+//-----------------------------------------
+// value of a number or a character constant such as '\n'
+int objConstant(char *s)
+{
+    if (s[0] != '\'')
+        return wrap16(atoi(s));
+    if (s[1] != '\\')
+        return s[1];
+    return s[2] == 'n' ? '\n' : s[2] == 't' ? '\t' : s[2] == '0' ? 0 :
+           s[2];
+}
+//-----------------------------------------
+// little-endian fields of the object file, stored at objOut
+unsigned char *objOut;
+
+void put32(int v)
+{
+    *objOut++ = v;
+    *objOut++ = v >> 8;
+    *objOut++ = v >> 16;
+    *objOut++ = v >> 24;
+}
+//-----------------------------------------
+void put16(int v)
+{
+    *objOut++ = v;
+    *objOut++ = v >> 8;
+}
+//-----------------------------------------
+// Place the dw lines, resolve the operands, and write name.ho.
+// The file is built in memory and written with one fwrite.
+void writeObject(void)
+{
+    FILE *f;
+    unsigned char *text;
+    char *p;
+    size_t size;
+    int i, k, address = 0, operand, isLabel;
+    
+    size = 20 + 8 * objCodex;
+    for (i = 0; i < objDatax; i++)
+    {
+        objAddress[i] = address;
+        if (objValue[i][0] != '"')
+            address++;
+        else
+        {
+            for (p = objValue[i] + 1; *p && *p != '"'; p++)
+                if (*p != '\\')
+                    address++;
+            address++;                          // the 0 word
+        }
+        size += 9 + strlen(objLabel[i]);
+    }
+    size += 2 * address;
+    
+    text = objOut = malloc(size);
+    if (!text)
+    {
+        printf("System error: out of memory\n");
+        abend();
+    }
+    memcpy(objOut, OBJMAGIC, 4);
+    objOut += 4;
+    put32(objCodex);
+    put32(address);
+    put32(strip ? 0 : objDatax);
+    put32(!strip);
+    
+    for (i = 0; i < objCodex; i++)
+    {
+        operand = isLabel = 0;
+        if (objCode[i].operand)
+        {
+            p = objCode[i].operand;
+            if (isdigit(p[0]) || p[0] == '-' || p[0] == '\'')
+                operand = objConstant(p);
+            else
+            {
+                for (k = 0; k < objDatax; k++)
+                    if (!strcmp(p, objLabel[k]))
+                        break;
+                if (k == objDatax)
+                {
+                    printf("System error: undefined label %s\n", p);
+                    abend();
+                }
+                operand = objAddress[k];
+                isLabel = 1;
+            }
+        }
+        put32(isLabel << 24 | objCode[i].op << 16 | (operand & 0xffff));
+    }
+    
+    for (i = 0; i < objDatax; i++)
+        if (objValue[i][0] != '"')
+            put16(objConstant(objValue[i]));
+        else
+        {
+            for (p = objValue[i] + 1; *p && *p != '"'; p++)
+                if (*p == '\\')
+                {
+                    p++;
+                    put16(*p == 'n' ? '\n' : *p);
+                }
+                else
+                    put16(*p);
+            put16(0);
+        }
+    
+    if (!strip)
+    {
+        for (i = 0; i < objDatax; i++)
+        {
+            put32(objAddress[i]);
+            put32(FALSE);
+            strcpy((char *)objOut, objLabel[i]);
+            objOut += strlen(objLabel[i]) + 1;
+        }
+        for (i = 0; i < objCodex; i++)
+            put32(objCode[i].line);
+    }
+    size = objOut - text;
+    
+    f = fopen(outFileName, "wb");
+    if (!f || fwrite(text, 1, size, f) != size)
+    {
+        printf("Error: Cannot write %s\n", outFileName);
+        exit(1);
+    }
+    fclose(f);
+    free(text);
+}
+//-----------------------------------------
+// number the next instruction and, for --line-map, map it
+void mapInstruction(void)
+{
+    if (mapFile)
+        fprintf(mapFile, "%d %d %d\n", instructionCount, statementLine,
+                statementColumn);
+    instructionCount++;
+}
+//-----------------------------------------
+// update the stack depth for instruction op
+void trackDepth(char *op)
+{
+    int i;
+    
+    for (i = 0; i < EFFECTCOUNT; i++)
+        if (!strcmp(op, effects[i].op))
+        {
+            depth += effects[i].effect;
+            break;
+        }
+    if (depth > statementDepth)
+        statementDepth = depth;
+}
+//-----------------------------------------
 // emit one-operand instruction
 void emitInstruction1(char *op)
 {
+    trackDepth(op);
+    mapInstruction();
+    if (object)
+    {
+        objInstruction(op, NULL);
+        return;
+    }
     fprintf(outFile, "          %-4s\n", op);
 }
 //-----------------------------------------
@@ -392,13 +769,42 @@ void emitInstruction1(char *op)
 // function overloading not supported by C
 void emitInstruction2(char *op, char *opnd)
 {
+    trackDepth(op);
+    mapInstruction();
+    if (object)
+    {
+        objInstruction(op, opnd);
+        return;
+    }
     fprintf(outFile,
             "          %-4s      %s\n", op,opnd);
 }
 //-----------------------------------------
+// a statement's code is complete: record its stack depth
+void endStatement(void)
+{
+    if (stackReport)
+        fprintf(outFile, "; stack depth %d\n", statementDepth);
+    depthCount[statementDepth < MAXDEPTH ? statementDepth : MAXDEPTH]++;
+    if (statementDepth > programDepth)
+    {
+        programDepth = statementDepth;
+        deepestLine = currentToken -> beginLine;
+    }
+    statementDepth = 0;
+    spillx = 0;
+}
+//-----------------------------------------
 void emitdw(char *label, char *value)
 {
     char temp[80];
+    
+    if (object)
+    {
+        objLabel[objDatax] = strdup(label);
+        objValue[objDatax++] = strdup(value);
+        return;
+    }
     strcpy(temp, label);
     strcat(temp, ":");
     
@@ -406,173 +812,1325 @@ void emitdw(char *label, char *value)
             "%-9s dw        %s\n", temp, value);
 }
 //-----------------------------------------
+// print the pending known text with one sout
+void flushOutput(void)
+{
+    char label[MAX];
+    
+    if (!outText[0])
+        return;
+    if (target == TARGET_INTERPRET)
+    {
+        fputs(outText, stdout);
+        outText[0] = '\0';
+        return;
+    }
+    if (stringCount >= SYMTABSIZE)
+    {
+        printf("System error: string table overflow\n");
+        abend();
+    }
+    if (target == TARGET_X86)
+    {
+        sprintf(label, "s_%d(%%rip), %%rdi", stringCount);
+        emitX86("leaq", label);
+        emitX86("call", "h1_sout");
+    }
+    else if (target == TARGET_JIT)
+        jitString(strdup(outText));
+    else if (target == TARGET_C)
+        cString(outText);
+    else
+    {
+        sprintf(label, "@str%d", stringCount);
+        emitInstruction2("pc", label);
+        emitInstruction1("sout");
+    }
+    stringText[stringCount++] = strdup(outText);
+    outText[0] = '\0';
+}
+//-----------------------------------------
+// add text to the pending known output
+void addOutput(char *text)
+{
+    if (strlen(outText) + strlen(text) > MAX)
+        flushOutput();
+    strcat(outText, text);
+    coalescedCount++;
+}
+//-----------------------------------------
 void endCode(void)
 {
     int i;
+    char label[20], value[2 * MAX + 20], *p, *q;
+    
+    flushOutput();
+    if (target == TARGET_X86)
+    {
+        endX86();
+        return;
+    }
+    if (target == TARGET_JIT)
+    {
+        endJit();
+        return;
+    }
+    if (target == TARGET_INTERPRET)
+        return;
+    if (target == TARGET_C)
+    {
+        endC();
+        return;
+    }
     emitInstruction1("\n          halt\n");
     
     // emit dw for each symbol in the symbol table
     for (i=0; i < symbolx; i++)
         emitdw(symbol[i], "0");
+    
+    // and for each string, with newlines written \n
+    for (i = 0; i < stringCount; i++)
+    {
+        sprintf(label, "@str%d", i);
+        q = value;
+        *q++ = '"';
+        for (p = stringText[i]; *p; p++)
+            if (*p == '\n')
+            {
+                *q++ = '\\';
+                *q++ = 'n';
+            }
+            else
+                *q++ = *p;
+        *q++ = '"';
+        *q = '\0';
+        emitdw(label, value);
+    }
 }
 //-----------------------------------------
-void factor(void)
+NODE *makeNode(int kind, char *image, NODE *left, NODE *right)
 {
-    TOKEN *t;
-    char temp[MAX];
+    NODE *n;
+    n = (NODE *)malloc(sizeof(NODE));
+    n -> kind = kind;
+    n -> image = image;
+    n -> left = left;
+    n -> right = right;
+    return n;
+}
+//-----------------------------------------
+// wrap an int to the 16-bit two's complement range of an H1 word
+int wrap16(int v)
+{
+    return ((v + 32768) & 0xffff) - 32768;
+}
+//-----------------------------------------
+// Compute the value of n at compile time using H1 16-bit
+// arithmetic.  Returns FALSE if the value is not known, either
+// because a variable it uses is not known or because H1 would
+// divide by zero (or overflow a divide) at run time.
+int evalExpr(NODE *n, int *result)
+{
+    int left, right;
     
-    printf("%s ", currentToken -> image);
-    switch(currentToken -> kind)
+    switch(n -> kind)
     {
         case UNSIGNED:
-            t = currentToken;
-            consume(UNSIGNED);
-            emitInstruction2("pwc", t -> image);
-            break;
+            *result = wrap16(atoi(n -> image));
+            return TRUE;
+        case ID:
+            left = enter(n -> image);
+            if (!known[left])
+                return FALSE;
+            *result = value[left];
+            return TRUE;
+    }
+    
+    if (!evalExpr(n -> left, &left) || !evalExpr(n -> right, &right))
+        return FALSE;
+    
+    switch(n -> kind)
+    {
         case PLUS:
-            consume(PLUS);
-            t = currentToken;
-            consume(UNSIGNED);
-            emitInstruction2("pwc", t -> image);
+            *result = wrap16(left + right);
             break;
         case MINUS:
-            consume(MINUS);
-            t = currentToken;
-            consume(UNSIGNED);
-            strcpy(temp, "-");
-            strcat(temp, t -> image);
-            emitInstruction2("pwc", temp);
+            *result = wrap16(left - right);
             break;
-        case ID:
-            t = currentToken;
-            consume(ID);
-            enter(t -> image);
-            emitInstruction2("p", t -> image);
+        case TIMES:
+            *result = wrap16(left * right);
             break;
-        case LEFTPAREN:
-            consume(LEFTPAREN);
-            expr();
-            consume(RIGHTPAREN);
+        case DIVIDE:
+            if (right == 0 || (left == -32768 && right == -1))
+                return FALSE;
+            *result = left / right;
             break;
-        default:
-            displayErrorLoc();
-            printf("Scanning %s, expecting factor\n", currentToken ->
-                   image);
-            abend();
     }
+    return TRUE;
 }
 //-----------------------------------------
-void factorList(void)
+// In evaluate mode every subtree whose value is known at compile
+// time is replaced by a constant.
+NODE *foldKnown(NODE *n)
 {
-    switch(currentToken -> kind)
+    int v;
+    char temp[MAX];
+    
+    if (n -> kind != UNSIGNED && evalExpr(n, &v))
     {
-        case TIMES:
-            consume(TIMES);
-            factor();
-            emitInstruction1("mult");
-            factorList();
-            break;
-            
-        case DIVIDE:
-            consume(DIVIDE);
-            factor();
-            emitInstruction1("div");
-            factorList();
-            break;
-            
-        case PLUS:
-        case MINUS: //adding MINUS, telling compiler to simply proceed if a MINUS token appears (lambda)
-            
-            
-        case RIGHTPAREN:
-        case SEMICOLON:
-            ;
-            break;
-        default:
-            displayErrorLoc();
-            printf("Scanning %s, expecting op, \")\", or \";\"\n",
-                   currentToken -> image);
-            abend();
+        sprintf(temp, "%d", v);
+        return makeNode(UNSIGNED, strdup(temp), NULL, NULL);
     }
+    if (n -> left)
+    {
+        n -> left = foldKnown(n -> left);
+        n -> right = foldKnown(n -> right);
+    }
+    return n;
 }
 //-----------------------------------------
-void term(void)
+// stack words needed to evaluate n, left operand first.  Adding or
+// subtracting a constant is awc, which needs no extra word.
+int need(NODE *n)
 {
-    factor();
-    factorList();
+    int l, r;
+    
+    if (!n -> left)
+        return 1;
+    if ((n -> kind == PLUS || n -> kind == MINUS) &&
+        n -> right -> kind == UNSIGNED)
+        return need(n -> left);
+    l = need(n -> left);
+    r = need(n -> right) + 1;
+    return l > r ? l : r;
 }
 //-----------------------------------------
-void termList(void)
+// number of operands of the chain of + and - (or of *) at n
+int chainLength(NODE *n, int product)
 {
-    switch(currentToken -> kind)
-    {
-        case PLUS:
-            consume(PLUS);
-            term();
-            emitInstruction1("add");
-            termList();
-            break;
-            
-        case MINUS:
-            
-            consume(MINUS);
-            term();
-            emitInstruction1("sub");
-            termList();
-            break;
-            
-        case RIGHTPAREN:
-        case SEMICOLON:
-            ;
-            break;
-        default:
-            displayErrorLoc();
-            printf(
-                   "Scanning %s, expecting \"+\", \")\", or \";\"\n",
-                   currentToken -> image);
-            abend();
-    }
+    if (product ? n -> kind == TIMES :
+        n -> kind == PLUS || n -> kind == MINUS)
+        return chainLength(n -> left, product) +
+               chainLength(n -> right, product);
+    return 1;
 }
 //-----------------------------------------
-void expr(void)
+// collect the operands of the chain of + and - (or of *) at n.
+// sign[i] is -1 for an operand that is subtracted.
+void collect(NODE *n, int product, int s, NODE **opnd, int *sign,
+             int *count)
 {
-    term();
-    termList();
+    if (product ? n -> kind == TIMES :
+        n -> kind == PLUS || n -> kind == MINUS)
+    {
+        collect(n -> left, product, s, opnd, sign, count);
+        collect(n -> right, product, n -> kind == MINUS ? -s : s,
+                opnd, sign, count);
+    }
+    else
+    {
+        opnd[*count] = reassociate(n);
+        sign[(*count)++] = s;
+    }
 }
 //-----------------------------------------
-void assignmentStatement(void)
+// Reassociation.  A chain of + and - (or of *) is flattened and
+// its constants are folded into one operand, in 16 bits like H1,
+// so the value is unchanged.  The other operands go deepest
+// first: a left-deep chain then needs one word more than its
+// deepest operand, which is the least any order needs on a stack
+// machine.  The constant goes last.
+NODE *reassociate(NODE *n)
 {
-    TOKEN *t;
+    NODE **opnd, *t;
+    int *sign, count = 0, product, c, v, i, j;
+    char temp[MAX];
     
-    t = currentToken;
-    consume(ID);
-    enter(t -> image);
-    emitInstruction2("pc", t -> image);
-    consume(ASSIGN);
-    expr();
-    emitInstruction1("stav");
-    consume(SEMICOLON);
-}
-//-----------------------------------------
+    if (!n -> left)
+        return n;
+    if (n -> kind == DIVIDE)
+    {
+        n -> left = reassociate(n -> left);
+        n -> right = reassociate(n -> right);
+        return n;
+    }
+    
+    // a chain can run over any number of lines, so the operand
+    // arrays are sized to it
+    product = n -> kind == TIMES;
+    i = chainLength(n, product);
+    opnd = (NODE **)malloc(i * sizeof(NODE *));
+    sign = (int *)malloc(i * sizeof(int));
+    collect(n, product, 1, opnd, sign, &count);
+    
+    c = product ? 1 : 0;
+    for (i = j = 0; i < count; i++)
+        if (opnd[i] -> kind == UNSIGNED)
+        {
+            v = wrap16(atoi(opnd[i] -> image));
+            c = wrap16(product ? c * v : c + sign[i] * v);
+        }
+        else
+        {
+            opnd[j] = opnd[i];
+            sign[j++] = sign[i];
+        }
+    count = j;
+    
+    // deepest first, keeping source order among equals
+    for (i = 1; i < count; i++)
+        for (j = i; j > 0 && need(opnd[j]) > need(opnd[j - 1]); j--)
+        {
+            t = opnd[j];
+            opnd[j] = opnd[j - 1];
+            opnd[j - 1] = t;
+            v = sign[j];
+            sign[j] = sign[j - 1];
+            sign[j - 1] = v;
+        }
+    
+    // a sum starts with an operand that is added, or else with the
+    // constant
+    for (i = 0; i < count && sign[i] < 0; i++)
+        ;
+    if (i < count)
+        for (; i > 0; i--)
+        {
+            t = opnd[i];
+            opnd[i] = opnd[i - 1];
+            opnd[i - 1] = t;
+            sign[i] = -1;
+            sign[i - 1] = 1;
+        }
+    
+    sprintf(temp, "%d", c);
+    if (count == 0 || sign[0] < 0)
+    {
+        n = makeNode(UNSIGNED, strdup(temp), NULL, NULL);
+        c = product ? 1 : 0;
+        i = 0;
+    }
+    else
+    {
+        n = opnd[0];
+        i = 1;
+    }
+    for (; i < count; i++)
+        if (product)
+            n = makeNode(TIMES, "*", n, opnd[i]);
+        else
+            n = makeNode(sign[i] > 0 ? PLUS : MINUS, sign[i] > 0 ? "+" :
+                         "-", n, opnd[i]);
+    if (c != (product ? 1 : 0))
+        n = makeNode(product ? TIMES : PLUS, product ? "*" : "+", n,
+                     makeNode(UNSIGNED, strdup(temp), NULL, NULL));
+    free(opnd);
+    free(sign);
+    return n;
+}
+//-----------------------------------------
+// Instruction selection labeler.  Computes, bottom up, the cheapest
+// rule that puts each subtree in each nonterminal.  Chain rules
+// are applied until no cost improves.
+void label(NODE *n)
+{
+    int r, c, v, changed;
+    RULE *rp;
+    
+    if (n -> left)
+    {
+        label(n -> left);
+        label(n -> right);
+    }
+    
+    for (r = 0; r < NTCOUNT; r++)
+        n -> cost[r] = INFINITE;
+    
+    for (r = 0; r < RULECOUNT; r++)
+    {
+        rp = &rules[r];
+        if (rp -> op != n -> kind)
+            continue;
+        if (rp -> small)
+        {
+            v = atoi(n -> image);
+            if (n -> image[0] == '-' || v > 4095)
+                continue;
+        }
+        c = rp -> cost;
+        if (rp -> left >= 0)
+            c += n -> left -> cost[rp -> left] +
+                 n -> right -> cost[rp -> right];
+        if (c < n -> cost[rp -> lhs])
+        {
+            n -> cost[rp -> lhs] = c;
+            n -> rule[rp -> lhs] = r;
+        }
+    }
+    
+    do
+    {
+        changed = FALSE;
+        for (r = 0; r < RULECOUNT; r++)
+        {
+            rp = &rules[r];
+            if (rp -> op != CHAIN)
+                continue;
+            c = rp -> cost + n -> cost[rp -> left];
+            if (c < n -> cost[rp -> lhs])
+            {
+                n -> cost[rp -> lhs] = c;
+                n -> rule[rp -> lhs] = r;
+                changed = TRUE;
+            }
+        }
+    } while (changed);
+}
+//-----------------------------------------
+// emit the cheapest cover of n that leaves it in nonterminal nt
+void reduce(NODE *n, int nt)
+{
+    RULE *rp = &rules[n -> rule[nt]];
+    char temp[MAX];
+    
+    if (rp -> op == CHAIN)
+        reduce(n, rp -> left);
+    else if (rp -> left >= 0)
+    {
+        reduce(n -> left, rp -> left);
+        reduce(n -> right, rp -> right);
+    }
+    
+    if (!rp -> instr)
+        return;
+    switch(rp -> operand)
+    {
+        case OPND_NONE:
+            emitInstruction1(rp -> instr);
+            break;
+        case OPND_SELF:
+            emitInstruction2(rp -> instr, n -> image);
+            break;
+        case OPND_RIGHT:
+            emitInstruction2(rp -> instr, n -> right -> image);
+            break;
+        case OPND_NEGRIGHT:
+            sprintf(temp, "%d", -wrap16(atoi(n -> right -> image)));
+            emitInstruction2(rp -> instr, temp);
+            break;
+    }
+}
+//-----------------------------------------
+// Spilling for --stack-limit.  n must fit in fit stack words when
+// it is evaluated; room words are free now.  A right operand that
+// does not fit is computed now into an @s temp, which the tree
+// then pushes instead.  Operands that do not fit in the temp's own
+// code are spilled first in turn, so every temp is computed at the
+// depth of the statement.
+NODE *spill(NODE *n, int fit, int room)
+{
+    char temp[MAX];
+    NODE *r;
+    int i;
+    
+    if (need(n) <= fit)
+        return n;
+    if (!n -> left || fit < 2)
+    {
+        displayErrorLoc();
+        printf("Statement needs more than %d stack words\n", stackLimit);
+        abend();
+    }
+    
+    if (need(n -> right) > fit - 1)
+    {
+        r = spill(n -> right, room - 1, room);
+        sprintf(temp, "@s%d", spillx++);
+        i = enter(strdup(temp));
+        known[i] = FALSE;
+        emitInstruction2("pc", symbol[i]);
+        label(r);
+        reduce(r, NT_STACK);
+        emitInstruction1("stav");
+        n -> right = makeNode(ID, symbol[i], NULL, NULL);
+        spillCount++;
+    }
+    n -> left = spill(n -> left, fit, room);
+    return n;
+}
+//-----------------------------------------
+// emit the cover of n, spilling first if it would not fit in the
+// stack words left under --stack-limit
+void genTree(NODE *n)
+{
+    if (stackLimit)
+        n = spill(n, stackLimit - depth, stackLimit - depth);
+    label(n);
+    reduce(n, NT_STACK);
+}
+//-----------------------------------------
+// x86-64 backend.  An H1 word is kept in a 32-bit register whose
+// low 16 bits hold it: add, sub, and imul give the right low 16
+// bits whatever is above them, so a value is only sign-extended
+// where that matters, for a division or a print.  Variables are
+// 16-bit words in .bss, loaded with movswl and stored with movw.
+// Each register name is given as 64, 32, and 16 bits.
+char *x86Reg[X86REGS][3] =
+{
+    {"%rcx", "%ecx", "%cx"},   {"%rsi", "%esi", "%si"},
+    {"%rdi", "%edi", "%di"},   {"%r8", "%r8d", "%r8w"},
+    {"%r9", "%r9d", "%r9w"},   {"%r10", "%r10d", "%r10w"},
+    {"%r11", "%r11d", "%r11w"}
+};
+char *x86Scratch[3] = {"%rax", "%eax", "%ax"};
+
+//-----------------------------------------
+// emit an x86-64 instruction
+void emitX86(char *op, char *operands)
+{
+    fprintf(outFile, "        %-7s %s\n", op, operands);
+}
+//-----------------------------------------
+// emit x86-64 code that leaves the value of n in register r.
+// Registers above r are free; if they run out, the left operand is
+// pushed while the right one is computed.
+void genX86(NODE *n, int r)
+{
+    char opnd[MAX], **right;
+    
+    switch(n -> kind)
+    {
+        case UNSIGNED:
+            sprintf(opnd, "$%d, %s", wrap16(atoi(n -> image)),
+                    x86Reg[r][1]);
+            emitX86("movl", opnd);
+            return;
+        case ID:
+            sprintf(opnd, "v_%s(%%rip), %s", n -> image, x86Reg[r][1]);
+            emitX86("movswl", opnd);
+            return;
+    }
+    
+    genX86(n -> left, r);
+    
+    // a constant or variable right operand is used in place
+    if (n -> kind != DIVIDE && n -> right -> kind == UNSIGNED)
+    {
+        sprintf(opnd, n -> kind == TIMES ? "$%d, %s, %s" : "$%d, %s",
+                wrap16(atoi(n -> right -> image)), x86Reg[r][1],
+                x86Reg[r][1]);
+        emitX86(n -> kind == TIMES ? "imull" : n -> kind == PLUS ?
+                "addl" : "subl", opnd);
+        return;
+    }
+    if (n -> kind != DIVIDE && n -> right -> kind == ID)
+    {
+        sprintf(opnd, "v_%s(%%rip), %s", n -> right -> image,
+                x86Reg[r][2]);
+        emitX86(n -> kind == TIMES ? "imulw" : n -> kind == PLUS ?
+                "addw" : "subw", opnd);
+        return;
+    }
+    
+    if (r + 1 < X86REGS)
+    {
+        genX86(n -> right, r + 1);
+        right = x86Reg[r + 1];
+    }
+    else
+    {
+        emitX86("pushq", x86Reg[r][0]);
+        genX86(n -> right, r);
+        sprintf(opnd, "%s, %%eax", x86Reg[r][1]);
+        emitX86("movl", opnd);
+        emitX86("popq", x86Reg[r][0]);
+        right = x86Scratch;
+    }
+    
+    if (n -> kind != DIVIDE)
+    {
+        sprintf(opnd, "%s, %s", right[1], x86Reg[r][1]);
+        emitX86(n -> kind == TIMES ? "imull" : n -> kind == PLUS ?
+                "addl" : "subl", opnd);
+        return;
+    }
+    
+    // both operands sign-extended, so the 32-bit quotient is exact
+    // and -32768 / -1 wraps to -32768 as on H1
+    sprintf(opnd, "%s, %%ebx", right[2]);
+    emitX86("movswl", opnd);
+    sprintf(opnd, "%s, %%eax", x86Reg[r][2]);
+    emitX86("movswl", opnd);
+    emitX86("testl", "%ebx, %ebx");
+    emitX86("jz", "h1_divzero");
+    emitX86("cltd", "");
+    emitX86("idivl", "%ebx");
+    sprintf(opnd, "%%eax, %s", x86Reg[r][1]);
+    emitX86("movl", opnd);
+}
+//-----------------------------------------
+// start of the x86-64 program: main saves %rbx, the divisor
+void beginX86(void)
+{
+    fprintf(outFile, "        .text\n        .globl  main\nmain:\n");
+    emitX86("pushq", "%rbx");
+}
+//-----------------------------------------
+// end of the x86-64 program, the runtime, and the data.  The
+// runtime prints through printf; main keeps %rsp 16-byte aligned
+// at each call, except while an operand is pushed, when the only
+// call is the one in h1_divzero, which realigns.
+void endX86(void)
+{
+    int i;
+    char *p;
+    
+    emitX86("popq", "%rbx");
+    emitX86("xorl", "%eax, %eax");
+    emitX86("ret", "");
+    
+    fprintf(outFile,
+            "\n%s runtime\n"
+            "h1_dout:\n"
+            "        movswl  %%di, %%esi\n"
+            "        leaq    h1_fmtd(%%rip), %%rdi\n"
+            "        jmp     h1_printf\n"
+            "h1_doutln:\n"
+            "        movswl  %%di, %%esi\n"
+            "        leaq    h1_fmtdln(%%rip), %%rdi\n"
+            "        jmp     h1_printf\n"
+            "h1_sout:\n"
+            "        movq    %%rdi, %%rsi\n"
+            "        leaq    h1_fmts(%%rip), %%rdi\n"
+            "h1_printf:\n"
+            "        subq    $8, %%rsp\n"
+            "        xorl    %%eax, %%eax\n"
+            "        call    printf@PLT\n"
+            "        addq    $8, %%rsp\n"
+            "        ret\n"
+            "h1_divzero:\n"
+            "        andq    $-16, %%rsp\n"
+            "        leaq    h1_divmsg(%%rip), %%rdi\n"
+            "        xorl    %%eax, %%eax\n"
+            "        call    printf@PLT\n"
+            "        movl    $1, %%edi\n"
+            "        call    exit@PLT\n"
+            "\n        .section .rodata\n"
+            "h1_fmtd:   .string \"%%d\"\n"
+            "h1_fmtdln: .string \"%%d\\n\"\n"
+            "h1_fmts:   .string \"%%s\"\n"
+            "h1_divmsg: .string \"\\nRuntime error: division by zero\\n\"\n",
+            comment);
+    
+    for (i = 0; i < stringCount; i++)
+    {
+        fprintf(outFile, "s_%d: .string \"", i);
+        for (p = stringText[i]; *p; p++)
+            fprintf(outFile, *p == '\n' ? "\\n" : "%c", *p);
+        fprintf(outFile, "\"\n");
+    }
+    
+    fprintf(outFile, "\n        .bss\n        .align  2\n");
+    for (i = 0; i < symbolx; i++)
+        fprintf(outFile, "v_%s: .zero 2\n", symbol[i]);
+    fprintf(outFile, "\n        .section .note.GNU-stack,\"\",@progbits\n");
+}
+//-----------------------------------------
+// --jit: x86-64 machine code for the program is written into an
+// mmap'ed buffer and called, with no assembler or linker.  The
+// variables are jitData, word i for symbol i of the symbol table,
+// addressed off %rbx.  An expression is computed in %eax, with the
+// left operand of a compound right operand saved on the machine
+// stack; %rbp holds the stack pointer so the division-by-zero stub,
+// at the start of the buffer, can return from any depth.
+unsigned char *jitCode;       // machine code buffer
+int jitx;                     // bytes used in jitCode
+int jitEntry;                 // offset of the program in jitCode
+short jitData[SYMTABSIZE];    // H1 words of the variables
+
+//-----------------------------------------
+// runtime called from machine code
+void jitDout(int v)
+{
+    printf("%d", (short)v);
+}
+//-----------------------------------------
+void jitDoutln(int v)
+{
+    printf("%d\n", (short)v);
+}
+//-----------------------------------------
+void jitSout(char *s)
+{
+    printf("%s", s);
+}
+//-----------------------------------------
+// append n bytes of machine code
+void jitBytes(char *bytes, int n)
+{
+    if (jitx + n > JITSIZE)
+    {
+        printf("System error: JIT code buffer overflow\n");
+        abend();
+    }
+    memcpy(jitCode + jitx, bytes, n);
+    jitx += n;
+}
+//-----------------------------------------
+// append a 32-bit immediate or displacement, little endian
+void jitWord(int v)
+{
+    char b[4];
+    
+    b[0] = v;
+    b[1] = v >> 8;
+    b[2] = v >> 16;
+    b[3] = v >> 24;
+    jitBytes(b, 4);
+}
+//-----------------------------------------
+// append a 64-bit address, little endian
+void jitAddress(void *p)
+{
+    unsigned long a = (unsigned long)p;
+    char b[8];
+    int i;
+    
+    for (i = 0; i < 8; i++)
+        b[i] = a >> 8 * i;
+    jitBytes(b, 8);
+}
+//-----------------------------------------
+// movabs $f, %rax; call *%rax
+void jitCall(void *f)
+{
+    jitBytes("\x48\xb8", 2);
+    jitAddress(f);
+    jitBytes("\xff\xd0", 2);
+}
+//-----------------------------------------
+// emit an instruction whose last operand is variable x, disp32(%rbx)
+void jitVariable(char *op, int n, char *x)
+{
+    jitBytes(op, n);
+    jitWord(2 * enter(x));
+}
+//-----------------------------------------
+// load the leaf n into %eax (reg 0) or %ecx (reg 1)
+void jitLeaf(NODE *n, int reg)
+{
+    if (n -> kind == UNSIGNED)
+    {
+        jitBytes(reg ? "\xb9" : "\xb8", 1);            // movl $c
+        jitWord(wrap16(atoi(n -> image)));
+    }
+    else
+        jitVariable(reg ? "\x0f\xbf\x8b" : "\x0f\xbf\x83", 3, n -> image);
+}
+//-----------------------------------------
+// emit machine code that leaves the value of n in %eax
+void genJit(NODE *n)
+{
+    int leaf;
+    
+    if (n -> kind == UNSIGNED || n -> kind == ID)
+    {
+        jitLeaf(n, 0);
+        return;
+    }
+    
+    leaf = n -> right -> kind == UNSIGNED || n -> right -> kind == ID;
+    
+    // a constant or variable right operand is used in place
+    if (leaf && n -> kind != DIVIDE)
+    {
+        genJit(n -> left);
+        if (n -> right -> kind == UNSIGNED)
+        {
+            jitBytes(n -> kind == TIMES ? "\x69\xc0" : n -> kind == PLUS ?
+                     "\x05" : "\x2d", n -> kind == TIMES ? 2 : 1);
+            jitWord(wrap16(atoi(n -> right -> image)));
+        }
+        else if (n -> kind == TIMES)
+            jitVariable("\x66\x0f\xaf\x83", 4, n -> right -> image);
+        else
+            jitVariable(n -> kind == PLUS ? "\x66\x03\x83" : "\x66\x2b\x83",
+                        3, n -> right -> image);
+        return;
+    }
+    
+    if (leaf)
+    {
+        genJit(n -> left);
+        jitLeaf(n -> right, 1);
+    }
+    else
+    {
+        genJit(n -> right);
+        jitBytes("\x50", 1);                         // pushq %rax
+        genJit(n -> left);
+        jitBytes("\x59", 1);                         // popq %rcx
+    }
+    
+    switch(n -> kind)
+    {
+        case PLUS:
+            jitBytes("\x01\xc8", 2);                 // addl %ecx, %eax
+            break;
+        case MINUS:
+            jitBytes("\x29\xc8", 2);                 // subl %ecx, %eax
+            break;
+        case TIMES:
+            jitBytes("\x0f\xaf\xc1", 3);             // imull %ecx, %eax
+            break;
+        case DIVIDE:
+            // movswl %ax, %eax; movswl %cx, %ecx; testl %ecx, %ecx
+            jitBytes("\x0f\xbf\xc0\x0f\xbf\xc9\x85\xc9", 8);
+            jitBytes("\x0f\x84", 2);                 // jz stub at 0
+            jitWord(-(jitx + 4));
+            jitBytes("\x99\xf7\xf9", 3);             // cltd; idivl %ecx
+            break;
+    }
+}
+//-----------------------------------------
+// map the buffer and emit the division-by-zero stub, then the
+// prologue: save %rbx and %rbp, align the stack for calls, and
+// point %rbx at jitData
+void beginJit(void)
+{
+    jitCode = mmap(NULL, JITSIZE, PROT_READ | PROT_WRITE,
+                   MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (jitCode == MAP_FAILED)
+    {
+        printf("System error: cannot map JIT code buffer\n");
+        abend();
+    }
+    
+    // movl $1, %eax; then the epilogue
+    jitBytes("\xb8\x01\x00\x00\x00\x48\x89\xec\x5d\x5b\xc3", 11);
+    
+    jitEntry = jitx;
+    // pushq %rbx; pushq %rbp; movq %rsp, %rbp; subq $8, %rsp
+    jitBytes("\x53\x55\x48\x89\xe5\x48\x83\xec\x08", 9);
+    jitBytes("\x48\xbb", 2);                         // movabs $jitData, %rbx
+    jitAddress(jitData);
+}
+//-----------------------------------------
+// return 0 from the program: xorl %eax, %eax; movq %rbp, %rsp;
+// popq %rbp; popq %rbx; ret
+void endJit(void)
+{
+    jitBytes("\x31\xc0\x48\x89\xec\x5d\x5b\xc3", 8);
+}
+//-----------------------------------------
+// emit a call that prints the string s
+void jitString(char *s)
+{
+    jitBytes("\x48\xbf", 2);                         // movabs $s, %rdi
+    jitAddress(s);
+    jitCall(jitSout);
+}
+//-----------------------------------------
+// make the buffer executable and run the program
+void runJit(void)
+{
+    int (*program)(void);
+    
+    if (mprotect(jitCode, JITSIZE, PROT_READ | PROT_EXEC))
+    {
+        printf("System error: cannot protect JIT code buffer\n");
+        exit(1);
+    }
+    program = (int (*)(void))(jitCode + jitEntry);
+    printf("\n");
+    if (program())
+    {
+        printf("\nRuntime error: division by zero\n");
+        exit(1);
+    }
+    munmap(jitCode, JITSIZE);
+}
+//-----------------------------------------
+// --c: the program as C for an optimizing compiler.  Each symbol
+// is a static int16_t and each operation is cast back to int16_t,
+// so arithmetic wraps as on H1 (int16_t operands are promoted to
+// int, where no sum or product of two of them overflows).  The
+// statements of main are written to a memory stream while the
+// program is parsed; endC writes the declarations, then them.
+FILE *cFile;                  // name-c.c while main is buffered
+char *cText;                  // text of main
+size_t cSize;
+
+//-----------------------------------------
+// emit n as a C expression of type int16_t
+void genC(NODE *n)
+{
+    int v;
+    
+    switch(n -> kind)
+    {
+        case UNSIGNED:
+            v = wrap16(atoi(n -> image));
+            fprintf(outFile, v < 0 ? "(%d)" : "%d", v);
+            return;
+        case ID:
+            fprintf(outFile, "v_%s", n -> image);
+            return;
+        case DIVIDE:
+            fprintf(outFile, "h1_div(");
+            genC(n -> left);
+            fprintf(outFile, ", ");
+            genC(n -> right);
+            fprintf(outFile, ")");
+            return;
+    }
+    fprintf(outFile, "(int16_t)(");
+    genC(n -> left);
+    fprintf(outFile, n -> kind == PLUS ? " + " : n -> kind == MINUS ?
+            " - " : " * ");
+    genC(n -> right);
+    fprintf(outFile, ")");
+}
+//-----------------------------------------
+// the includes and the runtime, then start buffering main
+void beginC(void)
+{
+    fprintf(outFile,
+            "#include <stdio.h>\n"
+            "#include <stdlib.h>\n"
+            "#include <stdint.h>\n"
+            "\n"
+            "static inline void h1_dout(int16_t v)\n"
+            "{\n"
+            "    printf(\"%%d\", v);\n"
+            "}\n"
+            "\n"
+            "static inline void h1_doutln(int16_t v)\n"
+            "{\n"
+            "    printf(\"%%d\\n\", v);\n"
+            "}\n"
+            "\n"
+            "static inline int16_t h1_div(int16_t a, int16_t b)\n"
+            "{\n"
+            "    if (b == 0)\n"
+            "    {\n"
+            "        printf(\"\\nRuntime error: division by zero\\n\");\n"
+            "        exit(1);\n"
+            "    }\n"
+            "    return (int16_t)(a / b);\n"
+            "}\n"
+            "\n");
+    cFile = outFile;
+    outFile = open_memstream(&cText, &cSize);
+}
+//-----------------------------------------
+// the variables, then main
+void endC(void)
+{
+    int i;
+    
+    fclose(outFile);
+    outFile = cFile;
+    for (i = 0; i < symbolx; i++)
+        fprintf(outFile, "static int16_t v_%s;\n", symbol[i]);
+    fprintf(outFile, "\nint main(void)\n{\n%s    return 0;\n}\n", cText);
+    free(cText);
+}
+//-----------------------------------------
+// emit a statement that prints the string s
+void cString(char *s)
+{
+    fprintf(outFile, "    fputs(\"");
+    for (; *s; s++)
+        if (*s == '\n')
+            fprintf(outFile, "\\n");
+        else if (*s == '"' || *s == '\\')
+            fprintf(outFile, "\\%c", *s);
+        else
+            fprintf(outFile, "%c", *s);
+    fprintf(outFile, "\", stdout);\n");
+}
+//-----------------------------------------
+// --interpret: no output file and no code.  Evaluate mode is on and
+// every variable starts known, so each statement is executed by
+// the evaluator as it is parsed, and print output goes to stdout
+// through the coalescing buffer.  Only an expression evalExpr
+// leaves alone, a division by zero or -32768 / -1, reaches
+// interpretExpr.
+int interpretExpr(NODE *n)
+{
+    int left, right;
+    
+    switch(n -> kind)
+    {
+        case UNSIGNED:
+            return wrap16(atoi(n -> image));
+        case ID:
+            return value[enter(n -> image)];
+    }
+    
+    left = interpretExpr(n -> left);
+    right = interpretExpr(n -> right);
+    switch(n -> kind)
+    {
+        case PLUS:
+            return wrap16(left + right);
+        case MINUS:
+            return wrap16(left - right);
+        case TIMES:
+            return wrap16(left * right);
+    }
+    if (right == 0)
+    {
+        fflush(stdout);
+        fprintf(stderr, "\nRuntime error: division by zero on line %d\n",
+                currentToken -> beginLine);
+        exit(1);
+    }
+    return wrap16(left / right);
+}
+//-----------------------------------------
+// emit code that leaves the value of n on top of the stack, or for
+// x86-64 in %ecx, or for --jit in %eax
+void genExpr(NODE *n)
+{
+    if (evaluate)
+        n = foldKnown(n);
+    n = reassociate(n);
+    if (target == TARGET_X86)
+        genX86(n, 0);
+    else if (target == TARGET_JIT)
+        genJit(n);
+    else if (target == TARGET_C)
+        genC(n);
+    else
+        genTree(n);
+}
+//-----------------------------------------
+// emit code that assigns the value of n to variable x
+void genStore(char *x, NODE *n)
+{
+    char opnd[MAX];
+    
+    if (target == TARGET_X86)
+    {
+        genExpr(n);
+        sprintf(opnd, "%%cx, v_%s(%%rip)", x);
+        emitX86("movw", opnd);
+        return;
+    }
+    if (target == TARGET_INTERPRET)
+    {
+        value[enter(x)] = interpretExpr(n);
+        return;
+    }
+    if (target == TARGET_C)
+    {
+        fprintf(outFile, "    v_%s = ", x);
+        genExpr(n);
+        fprintf(outFile, ";\n");
+        return;
+    }
+    if (target == TARGET_JIT)
+    {
+        genExpr(n);
+        jitVariable("\x66\x89\x83", 3, x);            // movw %ax, x
+        return;
+    }
+    emitInstruction2("pc", x);
+    genExpr(n);
+    emitInstruction1("stav");
+}
+//-----------------------------------------
+// emit code that prints the value of n, then a newline if newline
+// is TRUE
+void genPrint(NODE *n, int newline)
+{
+    if (target == TARGET_INTERPRET)
+    {
+        printf(newline ? "%d\n" : "%d", interpretExpr(n));
+        return;
+    }
+    if (target == TARGET_C)
+    {
+        fprintf(outFile, newline ? "    h1_doutln(" : "    h1_dout(");
+        genExpr(n);
+        fprintf(outFile, ");\n");
+        return;
+    }
+    genExpr(n);
+    if (target == TARGET_X86)
+    {
+        emitX86("movl", "%ecx, %edi");
+        emitX86("call", newline ? "h1_doutln" : "h1_dout");
+        return;
+    }
+    if (target == TARGET_JIT)
+    {
+        jitBytes("\x89\xc7", 2);                     // movl %eax, %edi
+        jitCall(newline ? jitDoutln : jitDout);
+        return;
+    }
+    emitInstruction1("dout");
+    if (newline)
+    {
+        emitInstruction2("pc", "'\\n'");
+        emitInstruction1("aout");
+    }
+}
+//-----------------------------------------
+NODE *factor(void)
+{
+    TOKEN *t;
+    char temp[MAX];
+    NODE *n;
+    
+    // token trace; --interpret leaves stdout to the program
+    if (target != TARGET_INTERPRET)
+        printf("%s ", currentToken -> image);
+    switch(currentToken -> kind)
+    {
+        case UNSIGNED:
+            t = currentToken;
+            consume(UNSIGNED);
+            return makeNode(UNSIGNED, t -> image, NULL, NULL);
+        case PLUS:
+            consume(PLUS);
+            t = currentToken;
+            consume(UNSIGNED);
+            return makeNode(UNSIGNED, t -> image, NULL, NULL);
+        case MINUS:
+            consume(MINUS);
+            t = currentToken;
+            consume(UNSIGNED);
+            strcpy(temp, "-");
+            strcat(temp, t -> image);
+            return makeNode(UNSIGNED, strdup(temp), NULL, NULL);
+        case ID:
+            t = currentToken;
+            consume(ID);
+            enter(t -> image);
+            return makeNode(ID, t -> image, NULL, NULL);
+        case LEFTPAREN:
+            consume(LEFTPAREN);
+            n = expr();
+            consume(RIGHTPAREN);
+            return n;
+        default:
+            displayErrorLoc();
+            printf("Scanning %s, expecting factor\n", currentToken ->
+                   image);
+            abend();
+    }
+    return NULL;
+}
+//-----------------------------------------
+NODE *factorList(NODE *left)
+{
+    switch(currentToken -> kind)
+    {
+        case TIMES:
+            consume(TIMES);
+            left = makeNode(TIMES, "*", left, factor());
+            return factorList(left);
+            
+        case DIVIDE:
+            consume(DIVIDE);
+            left = makeNode(DIVIDE, "/", left, factor());
+            return factorList(left);
+            
+        case PLUS:
+        case MINUS: //adding MINUS, telling compiler to simply proceed if a MINUS token appears (lambda)
+            
+            
+        case RIGHTPAREN:
+        case SEMICOLON:
+            return left;
+        default:
+            displayErrorLoc();
+            printf("Scanning %s, expecting op, \")\", or \";\"\n",
+                   currentToken -> image);
+            abend();
+    }
+    return NULL;
+}
+//-----------------------------------------
+NODE *term(void)
+{
+    return factorList(factor());
+}
+//-----------------------------------------
+NODE *termList(NODE *left)
+{
+    switch(currentToken -> kind)
+    {
+        case PLUS:
+            consume(PLUS);
+            left = makeNode(PLUS, "+", left, term());
+            return termList(left);
+            
+        case MINUS:
+            consume(MINUS);
+            left = makeNode(MINUS, "-", left, term());
+            return termList(left);
+            
+        case RIGHTPAREN:
+        case SEMICOLON:
+            return left;
+        default:
+            displayErrorLoc();
+            printf(
+                   "Scanning %s, expecting \"+\", \")\", or \";\"\n",
+                   currentToken -> image);
+            abend();
+    }
+    return NULL;
+}
+//-----------------------------------------
+NODE *expr(void)
+{
+    return termList(term());
+}
+//-----------------------------------------
+// TRUE if tree n has a node of the given kind
+int contains(NODE *n, int kind)
+{
+    if (!n)
+        return FALSE;
+    return n -> kind == kind || contains(n -> left, kind) ||
+           contains(n -> right, kind);
+}
+//-----------------------------------------
+// TRUE if the value printed for n is known at compile time: a
+// constant expression, or in evaluate mode anything evalExpr folds
+int knownOutput(NODE *n, int *v)
+{
+    if (!evaluate && contains(n, ID))
+        return FALSE;
+    return evalExpr(n, v);
+}
+//-----------------------------------------
+// TRUE if x = n leaves x unchanged: n is x itself, or x + 0, x - 0,
+// x * 1, or x / 1.  Other updates x = x op e already get the
+// shortest stack sequence, pc x, p x, e, op, stav (awc for + or -
+// a constant), since there is no instruction that operates on a
+// word in memory.
+int isIdentityUpdate(NODE *n, char *x)
+{
+    int c;
+    
+    if (n -> kind == ID)
+        return !strcmp(n -> image, x);
+    if (!n -> left || n -> left -> kind != ID || strcmp(n -> left -> image, x) ||
+        n -> right -> kind != UNSIGNED)
+        return FALSE;
+    c = wrap16(atoi(n -> right -> image));
+    if (n -> kind == PLUS || n -> kind == MINUS)
+        return c == 0;
+    return c == 1;
+}
+//-----------------------------------------
+void assignmentStatement(void)
+{
+    TOKEN *t;
+    NODE *n;
+    int i, v;
+    
+    t = currentToken;
+    consume(ID);
+    i = enter(t -> image);
+    consume(ASSIGN);
+    n = expr();
+    
+    // evaluate mode: a known value is only recorded; every later
+    // use of the variable is replaced by the value, so no store
+    if (evaluate && (known[i] = evalExpr(n, &v)))
+    {
+        value[i] = v;
+        evaluatedCount++;
+    }
+    else
+    {
+        if (evaluate)
+            n = foldKnown(n);
+        if (isIdentityUpdate(n, t -> image))
+        {
+            identityCount++;
+            endStatement();
+            consume(SEMICOLON);
+            return;
+        }
+        if (evaluate)
+            residualCount++;
+        if (contains(n, DIVIDE))
+            flushOutput();
+        genStore(t -> image, n);
+    }
+    endStatement();
+    consume(SEMICOLON);
+}
+//-----------------------------------------
+// count a print/println whose output is or is not fully known
+void countOutput(NODE *n)
+{
+    int v;
+    
+    if (evaluate)
+    {
+        if (evalExpr(n, &v))
+            evaluatedCount++;
+        else
+            residualCount++;
+    }
+}
+//-----------------------------------------
 void printlnStatement(void)
 {
+    NODE *n;
+    int v;
+    char temp[20];
+    
     consume(PRINTLN);
     consume(LEFTPAREN);
-    expr();
-    emitInstruction1("dout");
-    emitInstruction2("pc", "'\\n'");
-    emitInstruction1("aout");
+    n = expr();
+    countOutput(n);
+    if (knownOutput(n, &v))
+    {
+        sprintf(temp, "%d\n", v);
+        addOutput(temp);
+    }
+    else
+    {
+        flushOutput();
+        genPrint(n, TRUE);
+    }
     consume(RIGHTPAREN);
+    endStatement();
     consume(SEMICOLON);
 }
 
 void printStatement(void) {
+    NODE *n;
+    int v;
+    char temp[20];
+    
     consume(PRINT);
     consume(LEFTPAREN);
-    expr();
-    emitInstruction1("dout");
+    n = expr();
+    countOutput(n);
+    if (knownOutput(n, &v))
+    {
+        sprintf(temp, "%d", v);
+        addOutput(temp);
+    }
+    else
+    {
+        flushOutput();
+        genPrint(n, FALSE);
+    }
 
     consume(RIGHTPAREN);
+    endStatement();
     consume(SEMICOLON);
 }
 void nullStatement(void) {
@@ -589,7 +2147,9 @@ void compoundStatement(void) {
 //-----------------------------------------
 void statement(void)
 {
-   
+    statementLine = currentToken -> beginLine;
+    statementColumn = currentToken -> beginColumn;
+    
     switch(currentToken -> kind)
     {
         case ID:
@@ -608,7 +2168,8 @@ void statement(void)
             break;
             
         case LEFTBRACKET:
-            printf("COMPOUND");
+            if (target != TARGET_INTERPRET)
+                printf("COMPOUND");
             compoundStatement();
             break;
             
@@ -664,6 +2225,12 @@ void statementList(void)
 
 void program(void)
 {
+    if (target == TARGET_X86)
+        beginX86();
+    else if (target == TARGET_JIT)
+        beginJit();
+    else if (target == TARGET_C)
+        beginC();
     statementList();
     endCode();
 }
@@ -674,22 +2241,112 @@ void parse(void)
     program();   // program is start symbol for grammar
 }
 //-----------------------------------------
+// --stack-report: maximum stack depth of the program and the
+// number of statements reaching each depth
+void stackUsage(void)
+{
+    int d;
+    
+    printf("\nstack depth: program maximum %d", programDepth);
+    if (programDepth > 0)
+        printf(" (line %d)", deepestLine);
+    printf("\n%5s %10s\n", "depth", "statements");
+    for (d = 0; d <= programDepth && d <= MAXDEPTH; d++)
+        printf("%5d%s %10d\n", d, d == MAXDEPTH ? "+" : " ",
+               depthCount[d]);
+    if (stackLimit)
+        printf("limit %d: %d operands spilled to @s temps\n", stackLimit,
+               spillCount);
+}
+//-----------------------------------------
 int main(int argc, char *argv[])
 {
-    printf("S2 compiler written by Anthony J. Dos Reis\n");
-    if (argc != 2)
+    int argx;
+    char *listing;
+    size_t listingSize;
+    
+    // --interpret leaves stdout to the program: banner to stderr
+    for (argx = 1; argx < argc - 1; argx++)
+        if (!strcmp(argv[argx], "--interpret"))
+            target = TARGET_INTERPRET;
+    fprintf(target == TARGET_INTERPRET ? stderr : stdout,
+            "S2 compiler written by Anthony J. Dos Reis\n");
+    if (argc < 2)
     {
         printf("Incorrect number of command line args\n");
         exit(1);
     }
     
+    // options precede the file name
+    for (argx = 1; argx < argc - 1; argx++)
+    {
+        if (!strcmp(argv[argx], "--evaluate"))
+            evaluate = TRUE;
+        else if (!strcmp(argv[argx], "--x86"))
+        {
+            target = TARGET_X86;
+            comment = "#";
+        }
+        else if (!strcmp(argv[argx], "--jit"))
+            target = TARGET_JIT;
+        else if (!strcmp(argv[argx], "--interpret"))
+        {
+            target = TARGET_INTERPRET;
+            evaluate = TRUE;
+        }
+        else if (!strcmp(argv[argx], "--c"))
+        {
+            target = TARGET_C;
+            comment = "//";
+        }
+        else if (!strcmp(argv[argx], "--object"))
+            object = TRUE;
+        else if (!strcmp(argv[argx], "--strip"))
+            strip = TRUE;
+        else if (!strcmp(argv[argx], "--line-map"))
+            lineMap = TRUE;
+        else if (!strcmp(argv[argx], "--stack-report"))
+            stackReport = TRUE;
+        else if (!strncmp(argv[argx], "--stack-limit=", 14))
+        {
+            stackLimit = atoi(argv[argx] + 14);
+            if (stackLimit < 1)
+            {
+                printf("--stack-limit must be at least 1\n");
+                exit(1);
+            }
+        }
+        else
+        {
+            printf("Unknown option %s\n", argv[argx]);
+            exit(1);
+        }
+    }
     
     // build the input and output file names
-    strcpy(inFileName, argv[1]);
+    strcpy(inFileName, argv[argc - 1]);
     strcat(inFileName, ".s");       // append extension
     
-    strcpy(outFileName, argv[1]);
-    strcat(outFileName, ".a");      // append extension
+    if (target != TARGET_H1 && (stackReport || stackLimit))
+    {
+        printf("--stack-report and --stack-limit are for H1 code\n");
+        exit(1);
+    }
+    if (target != TARGET_H1 && (object || lineMap))
+    {
+        printf("--object and --line-map are for H1 code\n");
+        exit(1);
+    }
+    
+    strcpy(outFileName, argv[argc - 1]);
+    if (target == TARGET_X86)
+        strcat(outFileName, "-x86.s");
+    else if (target == TARGET_C)
+        strcat(outFileName, "-c.c");
+    else if (object)
+        strcat(outFileName, ".ho");
+    else
+        strcat(outFileName, ".a");  // append extension
     
     inFile = fopen(inFileName, "r");
     if (!inFile)
@@ -697,25 +2354,73 @@ int main(int argc, char *argv[])
         printf("Error: Cannot open %s\n", inFileName);
         exit(1);
     }
-    outFile = fopen(outFileName, "w");
+    
+    // --interpret opens no output file: the program runs as parsed
+    if (target == TARGET_INTERPRET)
+    {
+        parse();
+        fclose(inFile);
+        return 0;
+    }
+    
+    // --jit writes no file, and --object writes name.ho at the end;
+    // the source listing is discarded
+    if (target == TARGET_JIT || object)
+        outFile = open_memstream(&listing, &listingSize);
+    else
+        outFile = fopen(outFileName, "w");
     if (!outFile)
     {
         printf("Error: Cannot open %s\n", outFileName);
         exit(1);
     }
     
+    if (lineMap)
+    {
+        strcpy(mapFileName, argv[argc - 1]);
+        strcat(mapFileName, ".map");
+        mapFile = fopen(mapFileName, "w");
+        if (!mapFile)
+        {
+            printf("Error: Cannot open %s\n", mapFileName);
+            exit(1);
+        }
+        fprintf(mapFile, "; instruction line column\n");
+    }
+    
     time(&timer);     // get time
-    fprintf(outFile, "; Anthony J. Dos Reis    %s",
+    fprintf(outFile, "%s Anthony J. Dos Reis    %s", comment,
             asctime(localtime(&timer)));
     fprintf(outFile,
-            "; Output from S2 compiler\n");
+            "%s Output from S2 compiler\n", comment);
     
     parse();
     
+    if (evaluate)
+        printf("\nevaluate: %d statements evaluated, %d kept as code\n",
+               evaluatedCount, residualCount);
+    if (identityCount)
+        printf("\n%d assignments leave their variable unchanged: no code\n",
+               identityCount);
+    if (coalescedCount)
+        printf("\n%d print statements output by %d sout\n",
+               coalescedCount, stringCount);
+    if (stackReport)
+        stackUsage();
+    
     fclose(inFile);
     
     // must close output file or will lose most recent writes
     fclose(outFile);
+    if (mapFile)
+        fclose(mapFile);
+    
+    if (target == TARGET_JIT || object)
+        free(listing);
+    if (target == TARGET_JIT)
+        runJit();
+    if (object)
+        writeObject();
     
     // 0 return code means compile ended without error
     return 0;
@@ -0,0 +1,30 @@
+#!/bin/sh
+# Compile each benchmark tests/bench/name.s and report what it
+# costs: the cycles and words of the R1 cost model at -O0, -O1 and
+# -O2, with the memory operands of the register code, and the
+# instructions H1 executes for the S2 code.  Run from the top of the
+# tree.
+dir=$(mktemp -d) || exit 1
+for c in S2 R1 H1
+do
+    if ! cc -O2 -o $dir/$c $c.c 2> /dev/null
+    then
+        echo "cannot build $c"
+        exit 1
+    fi
+done
+for s in tests/bench/*.s
+do
+    name=$(basename $s .s)
+    cp $s $dir
+    for o in -O0 -O1 -O2
+    do
+        (cd $dir && ./R1 $o --stats $name) | sed -n \
+            -e "s/^cost: /$name R1 $o: /p" \
+            -e "s/^memory operations: /$name R1 $o: memory /p"
+    done
+    (cd $dir && ./S2 $name > /dev/null &&
+        ./H1 --stats $name 2>&1 > /dev/null) | sed -n \
+            -e "s/^\([0-9]*\) instructions executed.*/$name S2: \1 executed/p"
+done
+rm -rf $dir
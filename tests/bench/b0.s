@@ -0,0 +1,20 @@
+a = d + f + (b + d);
+h = (e * (g + d) + g + f);
+f = h * 38;
+g = f * e;
+f = c;
+g = (h * (b + g)) * d * b * e;
+g = (e * e * h * (f * d) + 88 * b);
+c = (((b * a) + a + g) * h * h + (c + a));
+f = a * d + 68 * h + (d + a) + d * d;
+f = h;
+f = a;
+h = g + e + e + e + e;
+a = (d + e) * a + g + d * 58 + 67 + g;
+g = (b * g + a + c + 31 * g + g + c);
+c = b;
+println(((h * f * d * c) * b + c + d));
+d = (a + f * (c + c));
+println(g);
+d = (b + g + b * 57) * b * 93;
+a = f + g + e * a * a;
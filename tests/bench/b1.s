@@ -0,0 +1,60 @@
+e = 48;
+f = (g * c);
+a = g;
+d = ((b + c * 74) + h * b + (91 + f)) + (e + d) + b * a + 8 + h + c;
+println((g + e * a * b * g * g + h + b + (95 + (80 * d)) * (h * g) + c + c));
+f = ((a + a * b) + ((f * e) + f + e) * ((a * h) + (f * g)) * f * g * c);
+g = g;
+println(((e + g) * e * f) + g + h * (d + g) + b);
+e = b;
+d = (a + g + h * f * (h * f)) * f;
+f = ((h * h + (h * f)) * g + e * (c + d)) * g + e;
+g = (c * h + g * h + h);
+println(g);
+b = (c * (c * h) * g * (f * b) * c + d);
+println(b * ((h + g) + f * b + a + (f * h)));
+d = g + (b + h + g) + a * ((c * b) + b);
+g = (h * e) * e + d * f * d;
+d = (e + e) * d + (e + g + c + e) + f;
+f = b + g + b;
+e = g;
+println(((g * h) + (d + g)) * (c + (e + e)) * d);
+b = (((a * e) + (33 * c)) + (c + d + 98) * g);
+f = f * (a + c) * (b * h + b) * d;
+g = (d + e + a * d) + (b * a) * (d + g) * 25;
+println(b + g * g);
+c = (a * ((a + a) * c + e) * a * f + g + c);
+println(d);
+h = (d + c + (g * b) + c) * g * b * d;
+println(d + b + 0);
+println((b * h * c + d * (a + g * f * h) + c + g + c * h + c + 77 * a + d));
+g = ((g * a) + b * a) * e + f;
+d = f + f * f * b * g * 25 + g * f + d + b * f * h * e;
+b = c * f + e * h + (f * a + b * h);
+println(((a * b + d * ((f + c) + (g * c))) * a * h * h + a));
+a = ((c + 12) + (f + e)) * (f + b) * e * 42 * (c * e) + e * d * h;
+f = (f * a * e + c * b) * (e * e) * h * e + (g + e * g * f);
+e = h + a * c;
+f = d * h + g + (c * b + f) + f + b + e + h + (h * b) + a * g;
+h = g * b * (d + d) * (a + a) + (h + ((e * b) + b + d));
+d = h + (h * b * (a * a)) + (a * a + d * (e * a));
+e = d + h * d * b + g + f + a;
+d = (h + b);
+println((f + e + a * (b * g) * (23 + h) * g * (88 + b) + (h * a) * d));
+b = ((h + 57) * e + h) + (((g + h) + f + a) + 63);
+d = e;
+c = (d + e * f * d + f * f + c) + (b + a * d * d + (b * (76 + c)));
+h = (d + b * h * h * e) + ((b * a) + d * 13 * e + (a * d));
+h = d + (b * e) + h * g + c * h * a + a;
+d = 8 * d * c * 88 + (d + b) * b * g * d + b + d + a + (a + 82);
+println(((h + c * d) + (c + e * h + h)));
+g = e * h + h * d + (c * f * g * b) + (e * g * h + d);
+a = ((h * 51 + d + (e * a) + h + g) + (((e + d) * e * f) + d));
+b = (d * f + (b * b) * 63 + (b + b) * (g + d));
+d = (g + e + g * a) * h;
+println(h + g + d + h + g + e + d + g);
+f = (g * (g * (c * a)) * f);
+e = b;
+d = (e + (e * d + (a * b)) * e);
+e = (g + (h * d)) * 78;
+f = 7;
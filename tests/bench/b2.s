@@ -0,0 +1,200 @@
+c = f;
+b = c + c * d * e * (g + c) * d + e * ((d + 24) + (h * d));
+f = 64 + h + c + b + g + c + g;
+a = c;
+a = (d * c + ((a + (h * c)) + (a * a + (h + h))));
+c = e;
+f = (g + g) * h * h + b * (d + f * h + c + e + b * 61 * h);
+h = a;
+d = b + (f * f * c) * (g * e) * d * h * c + (a + c);
+println(((a * a + c) * c) + e);
+f = (a * h) + g * a * (d * (h * c)) + (d + f + a + e + g + (a + e));
+g = e;
+g = (f + g);
+b = b * h + ((g * d) + g) * b;
+c = e;
+a = (e * e);
+f = (c + d * f + e + h + c + (c + g)) + (c * f * f * e) * (a + e) * b + b;
+println((e * c) * c * h + (h * c * f * h) * (a * d) + a * b + a + e + c + a);
+println(a);
+e = a;
+h = c;
+d = (f + a + g * d * c + (g + f) * (g * h) + a);
+println(((g + g) + g) * f * e * f + a + b * e * b * d + g * c + c);
+println(b);
+h = g;
+println(b);
+g = (b + f + g + (a + g * e + f) + g * h * b + c * f);
+d = d;
+d = ((a + h) + (d * d) * b + d);
+d = ((b + b * e + d) * f * e + a * f + b + 30 + d * h);
+f = (a + (31 + c + b + f));
+c = g;
+println(f);
+f = (c + (c * c)) + b + (h * a * g * f * (h + g) * b + e);
+println(c * a * (g * d) * c * a);
+h = (c * (e * h) + f * h + d * 70) * ((d * e) * h + a) + d;
+f = (73 + e) + a + (c * e + c * h) + f * d * f + (g * d);
+c = (b + a * f * c + a * a * b) * (d * (d * e) * c * f);
+h = ((h * (a * e)) + h) * e * 98 * g * (89 + d * (e * a));
+d = ((b + a) * a + a * f + b + (g * e) * g * a);
+a = b + (a + d + d) + d;
+d = d * a * a + a + e + a * e * g;
+g = (e + g + g) * e + h * e * h + (b + d + g + e) + b;
+h = (d + e + (c + c)) + (g + d) * c + 69 + (c + g * c * g);
+c = b + g + ((d * g) + h) + (a * f + b * d * d);
+g = h;
+c = a + b + e + a * a;
+e = h + f * a + d * a * h + d;
+g = (b + ((a + e) + f * d + d * (a + g)));
+h = ((h * h) + h) + (g + 9 * h) + ((21 + g) * a);
+a = (((23 * 1 * h * h) * b + f * h) + c);
+a = (h * d) * g * a + c + c;
+println(((d * f) * 17 + b + f));
+c = ((a + c) * c + e + g * c + a * h * b * (f + c * g + f));
+println((e * f) + d * f * b + g * a + c + (f + ((a + h) * h)));
+println(g);
+println((a + c + (b * e)) * h + c * g + c * g * g);
+b = (g + (a + f) + c) * ((41 + e) * h) * 60 * c + e;
+println(g * a * e * b + d * (e + d) + ((e * f) * (g * d)));
+c = h + c * (c + f + f * a) * ((a * b) + d * a * b + f * (c * f));
+a = c;
+println(g * g + (d * a) + (h + e + h) + d * 76 * f * h);
+d = f + b * (b * d) + (c + c * 96 + e) * (b + g + g + e) * f * 27 + (c + f);
+println(f + (54 + h) + f * c + f + d + g * c);
+c = g + (e + e) + f * (h + 45) * b * a;
+println(c + g * d * c + ((c * a) * (f * e)) * g);
+b = a + d;
+f = h + (d + a) + (d + g) * a * h + f + f;
+g = e * 6 + e + a + f * e + a + f * h * b + f;
+g = e * d;
+println((((26 * 64 * e * h) * b + e) * b + h * d + f + h * h));
+f = ((h * b) * 61 + a * d + (c * c) * e * b * a * (g * d));
+g = (c + 26 * d + b) + (c + c) + f + g + (e * a * f + a);
+println(a + e + e * f + h + (h + c) + (b + 57) * f);
+g = (f * f + b) + b * 13 + h + g * ((b + c) + c * f);
+println(c);
+h = d;
+f = ((e * b + c) * h) + a;
+h = ((f + (c + h) + d) * c);
+d = c + 45;
+a = (31 * e + b * h + d * g + a * d) + (c * h * f) * (f + b * (f * f));
+println(d + a * e + d + c);
+println(g);
+c = (h + (g + h * c * b * b + b * e));
+a = a * c * f + g + (h + d) * (d + a) * (d * f) + (f * g) + f + b * c;
+a = b + e * (b + g) + d * g + d + b * ((g + g) + (c + a) + c);
+f = (a * b + h * g * a + (e + h) + d);
+g = e * e + d + b * g + e + f + f + f;
+c = e;
+h = g * g;
+e = (b + d + d * e + (b + h)) + a;
+d = ((d * a + g) + (c * 79) * h * f * (g * (f + a) + h * b));
+a = a;
+println(e * b);
+println((15 * b * h * g + b * g * (a + e) + (b + c * d) + (e * h) + 77 + e));
+println((d * d * f * f + c));
+d = ((65 * h * g * (e + a)) + f);
+a = d + 82;
+println((18 * c) * (h * c) * h * b + f + c * 72);
+g = h + (e + a + h * a) * d;
+b = (e * g + (c * f) + c * a * g * g + e + h * f * f + h + f);
+a = f + h * (f + h) + a + c + (e * d) + (a * a) + e + b * a * g + b + b;
+d = b;
+d = f;
+b = d * e + b + a + c + (b + b);
+c = g * b + (e * c * g * a);
+println(e);
+println((g + f + a + e));
+g = b;
+h = (b + b * (g + g) + c + g * d * 29 + h + c * e + c);
+g = (h + g) + g + c + b * (39 + g) * f * f * 80;
+a = (g + h + c * c * c) * f * c;
+g = (e * e * (a + h)) * (f * d) + b + d * (e + c * g * b) * (e * g) + (f + g);
+println((b + e + (c * a * c * ((a * g) * f * a))));
+h = a * d * h + 89 * h;
+println((d + 19 * b + c + g * d + h));
+println(d + c + (b * a + c) + f);
+println(b + (a * (g * e)) + a);
+d = h + 99 + (d * d) + e + c + (b * h);
+g = (g + d * c) + f * b + f * 30;
+println(d);
+f = (d * a * b);
+f = h + ((f * g * h) + (d * h + c + f));
+e = (g + b + a + a + (g + e + (b * h))) + c + g * d * g + ((f * c) + (h + h));
+println(a + (c * b) + (d * d) + ((b + e) * a + f) * (h + 47 * f + g));
+println(((e + e + g * g) + h + d * a + f + d));
+g = (g * b * c * d * c * c * (b * f)) * (e + h + h * e + 20);
+println((e * (76 * a) + e + a * c + e * d * g * d + e * c + b));
+println(g * c + a * d * d * c * c * (f + a) * a * d);
+b = a + b * 90;
+a = ((a * h * a * ((c + f) + c * e)) * f);
+println(h * g);
+println(h);
+f = d;
+println(d + h + f * h + d + f + h + g + ((d * f) + (b * f)) * e);
+e = g * ((a + d) + 49 * g + b * g);
+a = ((h + d + (68 * e) * f * a + h) * c);
+c = b * c + e + c + d + (79 + f) + g * 33 * (h * d);
+c = e;
+println(d + (h + a) + e + 15 + (g + e) + ((g + e * (d + f)) + f));
+f = ((e + h) + h * 8 + d + (f * b * (e + h) + (a * b * h * b)));
+println(((35 * e + (c * b) * c) * ((e * g) + h + b) * d + h + (h * h)));
+println(d * d + e + (h + (g + d)) + (f + e) + (e * d) + (g + a) + (g + f));
+println(e * h);
+println(d * c);
+a = 49;
+b = g + (b + d) + h + e + a;
+println(d * (53 + (b + d)) + c + g * e * f);
+println(a * a * h * (d + b * a));
+f = ((a + b) + f * a * (e * g)) * 2;
+b = (e + (c + (c + g) + d * g));
+d = (e + h + e * c + h * f * a * b * (c * f));
+h = ((g * 32 * d * b) + ((d + c) * 69 * c) + e);
+println(c + (h + h * g + g * c * 46 + a));
+println((g * f * g + h + (d + d + g + a)) + 67 * f);
+h = a * 7 + d + b + (((h + c) * f * c) * (c * h));
+println(a);
+h = f;
+println(c + (c * 87) * g * (b * a + d * b * a));
+f = e;
+d = h;
+h = (e * h);
+println(88 * (g * b * 20) * f);
+g = (c + d * h + g + h) + (d + c) + g + b * (d + (h + e));
+println((c * h * f + g) + (h + f * e * h) + b * c * g * 34 + (h * d));
+d = e + b + c + e * e + h + ((b + g) * d + c + c * h + f + g);
+g = e * a + a * a * (a + (d + a) * (h + b * (e * a)));
+f = 94 * e * f + a + b + c + a + (d * a * a + g + b * h);
+c = g;
+println(c);
+println(e);
+c = (f * d) + 92 * (d * a + g * b) * a + h * h + a;
+println(d * (d * h) + b + b * e + f);
+c = ((b + 58) + a * f * f) + (c * b * c * e * d * d * g);
+b = ((b + a + a * (c + h + (c + c))) * b);
+f = (b + b);
+b = ((a + a + h) + (f * 83 * h * g) + ((d + e) + d * f * e + c * b * e));
+println(((d + f * f + f) + f + 38 * (g + d + f)));
+println(69 + (c * e) * a * a * (g + d * c));
+c = (a * (d * a) + g) + a * b * b * (e * d);
+c = ((b + f) * d * a * h * 52 + c + f + h + g * d * d);
+f = c * (c * h) + (e + c) + (g * 59 + g);
+b = (b + c * b + d + e + b);
+f = a;
+a = (((a + e) * e + e) + d + c * (a * a) * (70 + h * d + d) + (b * b) * c * b);
+c = (a + e * (g + a)) * c * (a * c * e * a + a);
+a = ((b * f * f + g) + b + g + c) * b + e;
+g = b + c * d + e * h + (d * d) + (e * b * (a * c)) + (f * c + h * g);
+f = d;
+println(d + e + 59 + h + (e + c) * d + h + 2);
+g = e;
+f = b * 10 + h * (f * d * (b * a));
+println(f + (f * f * f) + a + b);
+g = c + (c * (d + e) + g + c + e * d);
+e = (h + g + h);
+h = (b + h * e + h) + h + d * (h + g) * g + b + (g + c) + (e + a) + c;
+b = (c + e + d * f + e) * (d + 55 + d * b * e + f * c);
+g = a * e * d;
+b = (a + 16 + c + a * g * b * e + d * e);
+println(e * b + 10 * f + (d + b * d) + g);
@@ -0,0 +1,400 @@
+h = e * g * b * c * c + b + e * (b * b) + (c * d * a) * a;
+h = f;
+println(c + (a * e) + f + b + h + g * d + (42 * b) + d + b + e * (h * g) * (a + e + f));
+d = ((c + (g + g) + d + g * e + g) + (f * f * c * (h * e + g + b))) + (((d + a) * d * c) * d * (b + e) + (((d * f) + (g * f)) + a + d * g + c));
+println(b * f * (d * g) + (d * e + (h + g)) + b + h + d + b + a);
+println(b + (d * (g + 16) + f * b * f + (h * g)));
+d = d;
+println(g);
+g = (c + f) + (90 + e) * b;
+e = (((c * d + g + 67 + f * g * d) * ((d + 39) * (f * e) * (g * g * (c * e)))) * 59 * d * f * 58 * h + (((31 + h) * f + f) + d));
+e = h * f + ((f + h * h * h) * (f + e * a * c));
+e = ((51 + (g + b)) * f + f) * (g + ((d + h) + g) + (c * f + (e + f)));
+d = ((b * e + g * f) + d * f + h * (e * b) * f + 74) + f * e + b + e + e;
+d = ((g * a * (c + b)) * (h * f + c + b)) * ((g + g) * c * a) * a * 56 * b * (c * d) + a + a + a + a;
+f = h * d + 98 + c * g * c * d * b * a * ((g * c) * b) * 96 + d + a * d;
+g = d;
+d = b;
+b = a * d + g * (f + c) + c * a;
+g = f + e + d * g * ((b * b) + a * e) + (e * a) + h * e * ((73 * (f + (b * h))) * (d + d * h * 64));
+c = b;
+println(g);
+println((h * h * 99 + g) * a + g * f + (b * g + d + c + e) * (g * b + 95 + h * a * c * a * (e * 86 + c + d) + (h * f + g * g)));
+h = d;
+println((f + 70 * c + c * g * g * f) * (85 * f * g * e) * b * b * d + f * (d * 38));
+e = (g + g + e + (e + b) + c + h * f + b + 98);
+println(e);
+g = (f * (a + c * f)) + a * (f + 44 + 7 * e * (g * a * e + b)) + g;
+println(c * (b + f + e * h + h * a));
+println(e * ((a + b) + f * h));
+println(d);
+c = (((e + a + 16 + (h + b)) * (h * a + h + h)) + f);
+println(e * (f + 73 + c + e * (f + d) + ((c * d) + (e + c))));
+g = (e * (d * e * f + a) + e + h + (g * f * g));
+b = a;
+println(g + b + f * e + a + b * (h + e) * c + a);
+a = (a + f) + f + b * e + (68 * (b * a) * f * f + b * f);
+a = f;
+println((((a * e + e * f + (a + c + b)) * d + b + f + b * a + a) + a));
+println(h);
+g = (d + (28 + g + d * d + 36) + g + g * d * h * d * (a * f));
+g = (a + (c + f) + f + a * h * e * a + e + (a * h)) * 88 + g * d * a + e + e + (93 * h + f * f + (f + b));
+d = (d * (a * e) * c + d + h * e + b) + c + b * d + ((23 + h) + (b + g));
+a = c * g;
+println((e + f) * h * f * c * f * (f * b) * (f * a) + e);
+c = a + (95 * f + h + d * e * d * a + a * (c + g * e * h + d + g + h));
+f = f + ((f + (e * g)) * (g * c) + b) * f;
+println(8);
+println(c);
+e = (f + c + f + c + f + h * 55) * f;
+f = (g * g + f + a + g + f + c);
+b = e;
+println(d);
+a = e * ((g * h) * h * b + (d * e) + g + g) * h;
+b = c;
+println(h);
+g = (d + f * (c + h) + (d * e) + a * f * b + h * b * d * a + (e + a * (e + c)) + h);
+b = (c * ((c * b) * e + h * b * c + (a + g) * (e + g + c) * d * d + d));
+println(e + ((a + 59 * e + e) * (c * b)) * (b + d + (g * b) + d * (h + c)));
+println((((a + 48) + g * c + (a + 19 + e + b)) * ((d + a * a) * f * h)) + ((g + e + h + a) + f) * (a + c * a * (h * h * (e * b))));
+d = (b * g * (g * d)) * d * 80 * h * (c * c * h * (f * d) * a) + h + e * h + d + c + (g * d + e + (d + c) * e + f);
+println(((g + g + h + b + d + c * h) + (f * a * h * h * (h * d) + 68 * g)) * c + f);
+f = g;
+g = (a * b + e + h * (c * e) * (d + g) + d * c);
+g = 67;
+c = b;
+f = (e + (e + b * b * h + c * f) + (c + h));
+c = ((c * (c + e) * d + e * d * d * f + h * a) * a + d + g);
+f = (f * (a * g + h) + a * e * 39) * g + g * c * (a * h) + (h + (h + d) + b + 59);
+b = (((g + c) * b) * c + (a + (f + f)) + ((a + f + e + (c + h)) + h));
+b = a * ((g * g + a) * (d + g * e) + h + g * b);
+e = f + g + (b * f) + f * d + h * e * b * (f * h + f + 87 + d) * h + (h + b * b + b);
+g = g + ((b + b) * e) + d + (((d + c) + h + g) + b * b + f + e + (g + a + e + a + b));
+println(((f + c) * g * h + (h * c) + c * g) + c + (c * c + e * h) * (f + b) + (a * a) + ((g + g) * f * g) + (d * (b + f) + b + a));
+g = c;
+h = c + ((a * 97 + (h * e)) * h + e + c + g + g);
+d = (e * (c * b + f)) + (e * c + d + h * h + (h * g)) + h * a + 65 + f * f * (f * g * c * (c + h) + h + d);
+println(((b + c + c * (a * g) * f * g * (h + f) + g + a + (f + c)) + (a * f) + a + b + e * c * (h * h) + c));
+f = (h + c);
+println(g);
+f = g;
+println(c);
+g = (b * e * b) + g * (b * h) * (c * d * h + e * b * e + b + b) * h * b + f + b + d + (e * a);
+println((((g + a) * (b + f)) + (c + c * d * a) * g * g * h + a * d) * ((b + d + d * b) * (d + e) * (c + 26) + c * e + e));
+d = (g + c * (c * g + d + (e + 78) + (d * h)));
+println((h * f) + (4 * a + b + ((d + a * e * a) * h)));
+println(e);
+d = e;
+println(d + e * b + e * a * h + f + (g * 59) + (f * h) * h * h);
+d = b;
+c = 88;
+h = ((b * a + a + g + b * d) * (d + c + b + e * (c * g) * c + g) + g + (c * b * f + f));
+c = f;
+f = ((e * g + (f + e)) + e * h + a + a) + b + (g * ((h + h + g + a) + ((a * g) + h + e)));
+e = 63;
+println(((h * h) + b) * (h + d * c) + h * 11);
+g = (e * f * f * c * a + (h * c * b + c * (g * g * d * f))) + e;
+b = ((d + d + g + h * (a * d) * 92 * 2) + (c * 87 * d + b)) + (f * h + a * e * a + e * (f * h));
+e = e + a * ((d * h) + (e * c)) * a + g * d;
+c = (((g + e) + (f * e + h + e * e + 60 + (b + e))) * b);
+println((e * e + d + e * c * (d + d) + f + f * (c * b * c) * c * e * c + d));
+g = b;
+println(b);
+e = (e * a) + c * (f + a + g) + (a + g * h) * (a * d) * (g + b) * g * h;
+e = h;
+c = h * h * g + d * h * (d + c) + 40 * d + ((a + d) * (e + e)) * g * (g * a);
+a = c + f * a + (a * h) * d * f;
+f = h + h + 27;
+e = ((g * c) * f + c * a + b) * (h + e) + (g * e) * f + e;
+a = e;
+g = e + e + f * 38 * h + f * f;
+c = ((a * 81 + b * a + e) + f) * ((e + 46 * f) + a + a + (c + e)) + g;
+g = (e * (b + e + (h * d)) + b + h + d * a + h + b + e * c * e + (a * f * f * h));
+c = c + c * g * h + e * a * a * (a + d) + d + f * (d * e) * c * g * b * f + d;
+e = d;
+println(((a + a * d) * (a + g) * g * a * (g * c + e * e + d) * a));
+b = (d * (19 * (d * g + a * a)) + h);
+c = a + ((h * e) * (e * g)) + g + (d * f + (f * c) + g * b * d * h * e);
+println((h + e * d * c + (b + c)) + g * h);
+println((3 * (h * d * b * (c + c + g * f) + c * c)));
+d = ((h + 38 + (b * d) + d + c + d) + (b + 5 + d) + b * f + (g * b)) + ((g * e * f) + e * d + b + c * b);
+c = (b * g) + f * e * (d * h) * g * b + f * a * f + h;
+println(g);
+c = c;
+c = h;
+println(h + e * (h * a + d));
+println((92 + (e * (d * a + (c + e)))) * h);
+b = f * e * e + b + g + e + h + 46 * c;
+println(((c * (b * b) + c + b * (c + 39)) + d + (c * d * a + 35 * f * (e + a * b) * b * e + a * d)));
+h = (b + a * (e + g)) * 83 * a * b * d * g * f + h + a + h * a + (h * e * (e * b)) + (f + f) + a * b;
+f = (g + b) + ((a * g) + a) + (h * d * b + e) + b + 1 * e + b * f + b + (e * h * h);
+g = a;
+b = g;
+b = (c + (b * c + a * g) * g * ((b + c + (c + d)) * f));
+b = ((g + f) + g + b) + f * (a * c + 81) + (e + h + (h * a)) + e + h + a * e + b + f;
+h = (h + d + ((b + c) + 9 * b) * (f + f + f)) * f * c;
+c = d;
+e = g * (c * h + e) + (c + f + h * g * h);
+a = ((h * f + e + b * h * b) + h * h * ((58 + 78) + f + h)) * ((d * 38) * b) * e * a * b * (c + (24 * f * e));
+d = c * d + d * h * e + b + (c * e) * ((c + f) * a * c + (c + 66 + d)) * b + (g * b) * h * d + d;
+f = b * (c * f) + d + (e + g) * d + (c * 7 + h) + h * (a * e) * a + c + g + e * h;
+println(e);
+b = (b + ((c + h) + (b + d) * (e * b) * 2 + g)) * (28 + c) + (e * f);
+c = f;
+println(72);
+c = b;
+g = (d + (a * e + 56 * b * e)) + h;
+e = a + (((34 + a) + c) * (h * b) + b * b) + b;
+println(h);
+f = (((a + c * c) + f + (((f + h) * e * a) * (g + f) + e)) * b * (g + h));
+b = (f + (c * 99)) * (g + h * (g + f)) + g + d + d * d + h;
+println((92 + c * f + b * c * (c * a) * (g * b * a * d)) + (h + e + e + (e * e) + (a * 15) * g + (f + d) + ((c + h) + h + g)));
+e = d * (a * (g * h) + a + g + h * g) * (g + f * (c + g)) + b * e * d * 50 + e * f * f * c * h * g;
+b = ((f * e + a * (d * c) * e + f * d * d * (d + h)) * f);
+c = (h * 28 * f + e * e * ((78 * e) * e) * f + ((f + g) * g * a * d * e * f * c));
+println((f + (g + d * b + a) + h + (g + (b + a)) + (b + d) * (e * d)));
+g = a;
+println(d * b + d + a + h * c * b + c * g + b * c * (d + d + e * g * 4 * h + a) + d);
+g = (e * f) + (f * h) * ((b + b) * h * e) * (h * c * h * a + f + b * h + h) * (c + b * (c + h) + (b + f * d * f) * ((d * d) * a * a));
+b = ((e * a + h * 5 * c + a + a + (e * 68 * c + h)) * b);
+a = a * a + c * c + d + e;
+e = b + b;
+println((d + (g + c * d + c)) + (g * e + b * (c + f) * (e + c) * (f * d + e + c * 5 + (c + f))));
+e = e + c + f;
+f = b;
+f = e;
+e = (f + h * g + e) * (g * h * e * f) * h * a + ((g * d * a) * b * a * g + g + ((g * g) * a + 72) * c);
+c = (f * d + d * c * h + 31 + b + a * h + b + c * f * (c + d));
+b = (d + d * a) * b * a * (h + b) + ((a + h) + c) * f * (b + f) * d;
+h = (g + ((f * c) + (f * c)) * ((e + e) + (a * a)) * d + e + h + 78 + c);
+d = c;
+d = (((e * b * (f * g)) * ((28 + d) * a)) + ((d * a) * e) * (e * e * (e * b))) + ((b + d + (d + d)) * d + (c + f + (e * e)) + (f + b) * c);
+c = (75 * g + f + (h * g) * g * (d * a + f) * (e * b + d));
+b = (b + (e + h) + d) + h + b + h + d + h + (f * f) + (d * d * ((52 * a) + f * e) + e);
+g = e;
+b = 92 + c * g + h * (d * e) + h + (c + e * a + b) * f;
+c = (((d * c + a + d + d + f * (b + c)) + 70) * c * (d * d) + g + b * d * c + (c + a) + a + e + d + g + e + e);
+println(e + c + b + (a + a + a * a) * h + g);
+h = (b + g + b + h * ((e * c) * g + f)) * (f + ((a * c) * (h * h) + 85 * c * (c * d)));
+println((b + (a + (c + d))) + (h * a + e) + d + b * c * b + (b * g * d * h) + c * a + c + e + e + e + b + (b * c) * a + c);
+a = f;
+println(d * (a + d) + e + h * b + (g + g) + g * a + e + a + (h * d + g + h) * (b + h) + (d * c) * h * c + g + c);
+a = g + e + b * d + b + g + a * f;
+println(c * a);
+g = b * ((f * e) * d + a) * (h * c) + (b + d) + b;
+println(e);
+c = a + d + 41 + e * a * b + (e + c) * g + f + (a * e) + b + (g * b) * h;
+println((a + f * (d * a) * (g * h) + (g + 35) * h * e * (h + f) + e * h + a + b + d * a * g * e + (d * g * d * f + c)));
+a = ((h + 40 + (c * 33) + f * c) + d);
+println(c);
+f = (h + f) + c + a * b + a * f + (d + c + d * c) * (e + b + 31);
+println(((h * g * 55) + (e + h) * g + h) + g);
+h = f;
+g = h + f + f + f + (((a + e) * (g + g)) + c * e * e) * 78;
+g = (c + h) + (f + e) + d + a + h * e + d * h + d * c * (b * d) * b;
+d = c;
+b = e + (f * a * a + h) + e * 91 * (g + c) * (a + c) + c + a * (g + g) + e + f * (52 * c) * b + d;
+f = (a * ((g + d) + g * e) * b + h + b + c + g);
+c = (a + h * f * g * g + d + b);
+g = (c + g * e + d + d + g + c * (f * d) + e * e + g + (b + ((a * h + c + b) + b * g * a)));
+d = g * g * e * d + h * c * ((g * a * h) + (g * a + d + a)) * b * g * h * c * 84 * g + f + h * (d * d);
+f = a;
+h = d + e * a + g * c + c * c + d * (h * b) * a * 45 * e + ((((a * f) + f * d) + f) + (((d * e) + d) * a * g * b));
+g = g;
+e = (f + 12 + c + 39 * c * f + b + (e + 19 * (d + b) * f * d * f) + c * (h * c + h * (b + b * c + a)));
+d = (f + (g + b * b + h) * g + (e + e)) + c + (((b * e) * e + h) + 87);
+e = b;
+a = (e * d + (h * e) + b + d) + (h + d + a) * (h + e) * f + (b * e) * (15 + a) + h;
+b = (e * e) + b * g * ((b * a) * b * h) * (f + 71 * c * b + c * c + e) * ((e * ((c + e) * d * e)) + a * f * b * d * c);
+c = h;
+h = f;
+d = d;
+f = a;
+a = b + (f * 57 + b + b) * (b + f + (a * f)) * b * f + d;
+f = d + (a + b) + b * g + (c * 72) + c + h;
+g = b + a * b + (g * (0 * h) * c);
+g = (a + g * (b + g) + a + (e * (2 + d + e + a)) + (g + c + a * b + g));
+e = c;
+println(g * ((h * a + a) * (a + a * c * e)) + b * d + e * (e + g));
+f = (a + 7 + d * b * f + a + a) * f * d + e * f * e;
+d = (b * b + c) * f * d + h + c * h + 11 * 93 * (h + h) * d;
+h = g;
+h = h * h + a + b * (g * a) + (h * f);
+e = (c * h);
+g = ((h + g + 72 + f * (g + e) + d * 24) + ((h + b * a) * g * a * (g + g)) + d + 86 * (e * h) + g * a * g * ((f + h + e * h) * e * 84 + a + a));
+d = a + c * (f + a * c + d + h) + b * 39 + g * a * (f + g + (e + c));
+g = (((c * h) + a * b * (c + g) * e * b) + e) * (h * d + g) * (b + d) + a * c + (f + a * b + e) * (b + g + f);
+a = b + (((f + d) + h) + a * (h + e)) * a;
+a = (e * d + b * g + a * g) + f + b + a + e * a * b + (f * c) + e + d + d * f * ((e * h) * h);
+b = (f + h) + g + g * (h + h) + f + c + (b + g) + d;
+h = (e + a + a + h * a + a * ((c * e * (a * c) * h * (g + b)) * b));
+b = (a * e * b * (a + e) + b * c * ((a * e) * a * 36) + (f * 70 * (f + c * a)));
+e = (((f * a) * b * e) + (g + a) * (a * a) * a * f + d) + (c * (h + (0 * g * a)));
+e = (c * b * a + h) + (f * h + 10) * f + e * g + d * (32 * d * (d + h)) * h + f * e * e + f;
+d = (g * h * a * a + a + (d + f) + f * d * h + 20 * 84 + (a * h + e) + f * d * a + d * h);
+d = ((f + f * f * 97) + (h * h + c + b)) * a * c;
+a = a;
+h = ((g * c) + d * g) + g + c;
+f = g * f + a * f + (g * h) * (g + 47 + (1 + e * a + 29));
+println((e * c * e * g) + b + b + f + g * a + ((g + h) + h * ((d * f) + f + h)));
+b = e * ((((c + f) + c) + f + f + c * e) * (c + 73) + d * 92 + a);
+b = (a * (e + d * a)) * ((g * 83) + f * f) * c + (e + d + g * b) * (e * c * h + b) * g * h;
+g = (f * b + b * (c + f * h * d) + ((h + c + g) * d) * d * a + f + a * (c + 16));
+a = (b * (g + g + (a + g)) + a * h + (f * b) * b);
+println(h);
+f = (f * g * h);
+f = ((g + f + g + h * (e * d)) * d) * h * c + a * (e * c + e + d) * ((h + 37) + (a * h)) + c;
+a = c * 84 + (b * a) + b * a * c * e * e + (f * a + c + 55 + 3 + h * f + b * c);
+e = (a + g + a * (a * e) + e) * a;
+a = a + (c * 76 * e * b * b * a + a);
+println(e);
+b = a;
+println(e);
+println((d + c * b + e + ((h * h + a + f) + g)) * c);
+println((58 * g + (d + c) + e * h + a) * a * f + c + b + f * f + f);
+g = f;
+g = (d + d * 63) * ((d * e * e * c) + (f + b)) * f;
+println(b + (h + c * (c + c)) + c + c);
+d = a;
+d = (c + h + d + e + e * 85) * d;
+println(c + 60 + e + (g + f) * a + c * e + g + (c * a + a * c));
+h = 57;
+a = a;
+println((c + g + 34 + 75 * e + h * (c * f)) * d + g + d + g * (b + h * h) * (((d * a + (d + e)) * (g * b) + e) * h));
+println(((((d + 13) * c) * e * d) * b * d * e + b + f * (e * a * h + e) * h * (c + h) + (c + f) + h + (c + c * h + a)));
+g = c * h + b * a + e + e + g;
+e = h;
+d = ((b + (g + d)) * (g * d + f + b + e + a * 91 + g) + e);
+println(f * ((e * (e * c)) * h * (f + f * (d * g) + g + c * g * f)));
+f = d * a + e + (e + h * d * f) + g + (b * g + e + f * (g * e) + d * g);
+c = d;
+println(e + (g * h) * (8 * d * f) + ((d * e + e + f) * a) * h * (e * f + d + b) * (b * 3) * h * a * (h * f * b));
+println((((a * c + a) * d + f * a) * ((d + b * a * a) * e)) * (d * a) + c + g * (f + h + e) + ((h * (c + h)) * d));
+f = f + d;
+println(((g * c * b * g + (b + c * e) * g) + c + (f * h * h * g) * (a * g * e) + 59 + d * e * a));
+f = g + (c * 85 + b * d) * ((b * h) + 38 + g * a) * f + f + c + h * h + b + a * e * 11;
+println((g + h));
+h = ((b + f) + e * d + e * d + d * e + e);
+println(((((g * f) + (c * a)) + (b * h) * (6 + a)) + (b * h * e) * (f + g) * (d * c) + ((e + c * h * (c + a) * c * h) * c)));
+b = (g * h * a * d * ((b + d * f * 34) + h + d + f) + (d + (b + h * b + 47) + (g * h * (c + d))));
+b = (h * (h * d * (c + b) + e * g * a + c * c));
+c = ((a * (e + b) + (e + a) + 90 + b) * (((b + b) + 82) * f)) + g;
+d = f + e;
+e = 64 * (e * b + e * b + a + g * g) + (h + a) + (g * f) * g + f * c;
+println(d + b * d + 10 * e * (f + b) + (h + (a + g)) * c * 7 * a * h * 96);
+println(a);
+println(b + (f * d + f) * h + 31);
+println(g);
+println(f * e * ((e + f) * d * d) * ((d + d) * e * g + g * (c + a)));
+g = g + (a * a * (f + h)) + (h * e + 98 + g) + e * f;
+g = (((c * g * h + e + g) * c + d * g + a + (26 * g + d + h)) + a + (c * h) * d + h * h + 67 + a + f);
+println(((b * c + b + d) + ((b + c) + c + c)) * (g + f) + (a + f) * b + h);
+h = (d * e + h * 79 + (g * e) * c);
+g = (((f + (47 * c)) + e) * a * f * e * f + d * d * 85 * 38 + (h * d) + h + h);
+println((c * a + d) * (a * f + c) * (d * c * 8 * (d * d)) + h);
+e = h * d + f;
+println((a * 48 * d + a + d * a + d * d * a));
+c = a;
+a = g + c * c + c + (b + a * (41 * a)) + c * e * g + b + c + f + (b * c + (e + e) * (b * h) + a * c + (32 + e * e));
+c = ((e + a * f + e * a) * c) * h;
+c = (c + g * h + a + c * ((h + f) + e + e * (a * (h * b)))) + (g + f * c + c * c + d) + e * b + g + g * h + c + f;
+b = h * h * g + 19 * (b * 8) + a + g + c * f + b * a + (a * a * a + (e * b) + (b * (b + a) + a + g + (d * b)));
+println((f * a * ((h + e) * b * a) * a));
+a = ((a * e + d + (h + g) + h) + f + b + c + d + (f + c) * h * 76);
+println((c + (b * h + f + 24) + b * f * (b + a) * g));
+b = (g * 54 + (a + f) * g * b + a * 65 + f * g + b + h + c * f + h);
+c = e + (d + h) * (f + (f * 45)) * b * (f + d) + (g * d) + e * b + (b * (c * g));
+println(h * (a + h * d + 80 * c * b));
+c = e + (f + g) + d + (e * c) * 32 * g * f;
+println((f * b * (g + g) * d + h + ((g + a * (c * f)) * (83 * e) + c)) + (h * b * c * f * c + c));
+println(c);
+d = ((c * f * f + b * c * e + a * e * e * (a * h + (d + g))) * c + e);
+h = 29;
+h = h * g * c + g * 62 * (g + a);
+a = 39;
+println(c);
+b = a;
+h = ((h * a) + 73 * f + d + e + b * h) * (d * e * (g * h) * (d * (24 + c))) + ((c + h + d) * a * 88 + c + c * c * (d * h) + e * c + a);
+c = ((((e + a) * e) * e) + d + a + 33);
+b = (f + a);
+println(g + h * h + a * a + (50 + c) + b * (b * g) * h + c * (27 + g) * d + b * a * e + (e + b + (6 + b)) + d);
+h = ((a + (h * 31) + (f + f + e + 26) * ((c * b) + f * 39) * (b * b + b + g)) + (h + c) + (e + f) + (f * d + f) * h * b + c + d * ((h + 18) * g * a));
+println(d + (f * a + f * h * b * c * a) + e * (f * d * h * a) + c + g);
+h = e * a + e * c + h * e + a + e + (g + a * h * h) * (f * c) * (e + b) * (c * d) + e + d * (e * h) * h + (g * g) * (b + h) * d;
+g = (((d * b) * (c * c)) + a * f + a + (a + e) + b * d * f + 99) * f;
+a = (g * h) + (c * a) * (a * f + b) * e * d * f * ((f + d) * b * h) * 27 + (f + a) * ((g * b) + b + g);
+println((d + b) * f + c * c + e + g);
+g = ((44 + 21 * (a + 6)) + a + a * a) + c * 19;
+e = f * (h + e);
+a = (h + c + c * f + f * g + g * (e * h)) + (h + b + ((d * d) * (c * d)) * a + h + d);
+g = b + e * e + a + e * g + (e + f) * 77 + c * a;
+c = e * g * h * d + g + b * (g + f) + (f + e * h + h);
+f = h + a * h + a + 33 + g * h + g + (b * d) * (c + f + h + c) * (c * h * 13 + a) + c;
+e = a;
+println(c);
+println((((g + a) * (d + g) * 8 + (d * g)) + ((g * g) * f + h) * (31 + f) + h) * (f + d + b + f * ((f * h) + c)) * (f * a + d + h + b));
+f = 68;
+e = (c * (d + b) * f * 22 * h) + (e + c + ((a + g) + a * d));
+d = (d + (g + c * b) * h + a + a + g * d * (c * e * g * h) + a * d * h * f);
+g = h * c * c * b * d * g * (a + c) * (e * a + f) + h * a + f + (h + f + h * g * f + a) + f;
+println((h + g * c));
+println(d + a * (e * (b * h)) + ((g + h) + (f * f)) * (27 * c + h + b) + d + g * 68 * f + a);
+h = ((b + h * e + e) + (f * c * g * e) + c * 44 + e * c * (b + h + c + c) * h);
+println(71 + d * a * e + 39 * (d * (a + e)) * a * d * e + f + b * (c * a * e + a) + c * c + (a * f) * (b * e * g));
+f = h * (c * g + c * a * g) + a;
+g = ((a + (b + a + c * a + (e + 30) + a)) + g);
+println(b);
+println(d);
+d = (a * b + e + d + c + c + b + h * (c + (h * h)) + a + c + e + e) + c;
+println((g + d) + (a * b) * (c * h) * h + h * (d * a * h * d * a * e + c) * (d * ((h * a) * g)) + d * c * (c + c) * h);
+println(b);
+b = d;
+e = ((f * f + (g + f)) * ((c + g) + h * c)) + h + (h * c) + a * c + g * a * (46 + d * e * c * (d + (d + b)));
+println(h);
+println(a + (d + d + (e * e)) * c + c);
+println(e + h * d + (a + c) * (94 * g) * c * c * g);
+println(h * e + h + (h * f + c + b) + ((b * c + (a * 31) + g + c * a) * a * e * a + g + 83));
+println(d + ((f * g) * (c + e) + f * f + g * a + (c + b + a * d)));
+c = (h * (e + b) * a * g * (e * f) * d + c + c);
+d = (e + 93) + a * g * (a + f * b) * 9 * (h * a);
+b = c;
+h = ((((e * a) + f * f) + e * d * g + (a + (h * d * (h + d)))) * a + 76 * (e * 62) + g * b);
+d = (c + (g * c) * b + (h + 8 + c + 28 * (h + h)) * (b * 90 + (h + f) * (g + g + c * a) * a));
+println(c);
+println(g + d + (h * b + (a + b) * ((a + e) + h) + a * 75 * (b + g)));
+a = e + d + g * d + f + (b * a) * (c + d + a + 97 + h) + ((f + c + c * f * e) * b);
+println(((a + 43 + h) + g) * (f + h + (c * b)) + (h * c) + (d + a * (c * f) + a + b + a * b + g + c * c));
+h = (e + a * d + d * c * (d + a) + h) * (h + c * f * d + d * a + h) * (h * (c + 18) + a * a);
+println((a + (g * b) * b * h * (f * g) * b + (g + g * g + ((e * g) + d * g) + h * f)));
+f = (f * ((e * f) * e + e + a * b + f) * (b * g + h + a) * (h + b + e) * 57 * d);
+f = (c * a);
+b = (46 * g + b + g + b + e) * b * f * a + e * f + g + f * a + d;
+e = (d * f + d * c * e) + d * c * f + (h + c) + d * g * (e + 66) * b;
+f = (d + c * g + g + c + a + h + b + a * e + b * (b * d) * (f * h * g + c));
+g = a;
+println(b);
+h = e * (f * e * h * a) + (f * d + f * (f + d) + (a + h) + ((f * d) * a));
+b = b;
+b = a * h * c + c * b * 9 + h * c + d * f * a * 77 * d + 92 + ((b * d * (c + c)) * (e * h * e));
+f = d;
+d = (e * 33 * g + f) + b + (e * c + e * g * (b * c + e + a) * (a + 3 + g + c * 77));
+c = g;
+h = d;
+println(h + g * c + b + e + f + d + b + c * h + 55 * (b + 6 + a) * c);
+println((c * (f + b + e * d) + (h * c) * a + d * d * a * a * e) * ((f * c + h + a) * 17 * e + f * ((b + h) * (h + 16)) * ((c + f) * g * c)));
+a = g * a * d + h + f * b * h * h * a * g + h;
+g = (b + c * f * d * h * g + c * (((g + b) + d * h) * a * h + a) + h * g);
+g = g * c;
+println(h + b * 41 * ((g * 98) + e + a + (f * b) * a));
+f = ((e + h) * h);
+h = ((b * 58 * g * d + h + a + e * b) + (20 * g) + a + a + (d * a) * f * d);
+a = a * b + e + ((c + 49) * (f * f)) * b + e + f * h * ((d + e * g) * c * f * (49 + d)) * d + f * c * c + e;
+c = c * ((a * a * (b * e)) + d + (b * c * b * e + e + f));
+b = ((e * f + e) + f * 74 + b * 25 * h + e);
+b = ((h + e) * c + b * g + d) + d;
+println(a + ((b + a) + (d + h) + d + e * d));
+d = g + (g * e) + b * c + h + a * e * g + (a * h + (g * g)) * b;
+f = (h + 47 * a * g + d) + e;
+g = c;
+c = 82 * e;
+f = b + (a + h + f + a * b * b * c) * (22 + 2 * (f * h)) * b;
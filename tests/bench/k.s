@@ -0,0 +1,151 @@
+f = (299 + a + s + -38 + s) * (b * d * -102 * p) * c + w * (199 * -149 * 279 * -232);
+f = (q + ((d + w) + v + 183 * h) + (-194 + -71 + (r + 178 + 171)));
+println(38 + g * (r + s) * p + -131 + t + r * s * v * -248 + e + 294);
+println(e);
+println((-167 * -276));
+g = 211;
+f = (((u + q + -282 + 111) + (-290 + v + -165 + -167) + 285 + t + 174) + s);
+h = (p * (u + t + 126 * a * 36 * w + (q + 202)) * (-10 + u + f + p * d + -29 + 68) * (173 + q * (130 * u * -264) * -188 + w * 67));
+f = (s + h * -10 * -24 * -105 + -53 + p + b + (65 + -243 + w + w) + (s + r + 34 + 105) * s + (u + s + u + -109) + 80 * v);
+h = q;
+h = ((-92 * q * f + -120 + q * v + -222 + w) * 249 * t);
+f = e;
+h = (b + 97 + (28 + d) + r + 7 + (174 + 16 + 25 + u)) * p + s + 84 + -177 + r * -270 * v;
+b = (((-269 + t + b + u) + h * 148 * 263) * f);
+println(51);
+g = -167;
+f = v;
+c = (v * (165 + g) * ((w + -235 + v) + 147));
+d = w;
+println(u * w * 190 * v * -108 * t * (33 + f + r) + v);
+b = ((s + s) + -245 * a * q) * -39;
+c = (v + (-255 * r * 9 * h * 44 * r * q * 136 + 206 + p + u) + g + b + 171 + u + (e + -169));
+h = e;
+e = (((w + r) + t + w + p + 94) + ((47 + q) + (282 + w + 76 + 72)) + f + -175 + t + d + (q + e + 242) + (252 * p) + 8 + -38 + 288 + q);
+a = ((83 * -203 * -154 * -258 + v * -105 * -39 * c + 22 + s + -130 + h) + v + (49 + u));
+d = (-183 * s + q + 277 + 153 + (e * p * q) + v + a + v + -172);
+d = (u * s * g * t * c * (d * r * v * -137) * (p + d + 132) + (q + -60 + -192) + -195 * e * v * r + 123 + w);
+c = s;
+f = f;
+b = b;
+c = t;
+a = u;
+e = ((v * p) + -150) + w + (-130 + -65 + p) + -258 * u + (t * u * w) + (q + -273 + 25 + v + 157 + s) + u;
+a = (-72 * q * 21 * 5 * t * p * 44 * (c * v * -22 * u)) + r * -285 * u + -104;
+b = (u * 186 * 188 + (v * 270 * -199) + w * 139 * 145 * -224 + (s + q + 77 + r));
+d = b * e * ((58 + 12 + u) + 138);
+h = ((49 * (s + q)) + ((a + 32 + -215) + 262));
+a = (95 + (222 + v) + q + u);
+f = (((v * -247 * -92) + (b + -168 + g)) + -143 * (206 + 252 + 285) + (r * v * u) + (q + 201) + -256 * a * s * 7 + q + -221 * (t + s + 13));
+g = 116;
+h = (b + (281 + -179 + (28 * p * t)) + -153 + ((p * f * -97 * 28) + q + r * 292 * 243 * s));
+a = (212 + 222 + w * 57 * 247) + p + (-106 + w + 277 + 74) + h * 238;
+g = (-136 + (p + 157 + (t + t + r)) + f);
+c = w;
+println((55 * q));
+c = -294;
+g = 20;
+a = v;
+d = (h * s * w * u * (u * t * -126) * 186) + ((-44 + g + -39) * (-103 + 191 + e + s) * -20);
+d = (-37 * 172 * 8 * 189 + -90 + 135 * 12) + p;
+g = (-120 + ((-55 + c + -209) + (p * 29 * -16 * 178) + t) + v + -92 + q + (u + u) + (p + b + 143));
+b = -188;
+e = (-57 + (w + -84 + f) + -244 + p * u);
+b = v;
+d = (36 * r * 154 + (g * 64 * r) * g + (d * t) * 0 + -183 + g + u * q * w + q + -152 + -228 * b + a + p);
+println((v + s + h) + -274 * 222 * a * t + (204 + w + h + 4) + d + w + q + e * e + (w * v * h * -147) + 144 + v + -103 + -22);
+a = v;
+c = q;
+b = (-235 + (24 * w + (b + -104 + 213)) + (r + 256 + 154 + w + w + q + u));
+println((w + (93 + t * v + w) + ((u + p) * q + -288 + r + -31) + (-204 * g * 183) + v + g + -37 + -89 + r + 199));
+println(((s + v) + 13 + t * p * p));
+h = (v * t * (p + v + q) * -185 + -200) + (t * v * 67) + (s * 162 * e * d) + (w + 76 + q) + (s + v + d);
+d = (37 + h + (v * f + 1 + v * -238));
+a = (h + 25 + -5 + 231 + (25 + 255 + s) + -15 + (233 + 53 + v + -2 + 38 + w) + (w + d + d + v) + (u * -9));
+f = 23;
+b = ((p + r * t * p * -116 + (-183 * u)) + s);
+a = h;
+c = ((g + -55 * p) * c * q * t + r * 279 * (80 + (126 + r) + -93));
+f = s;
+d = (71 + w + 238 + h * p * v + (-49 + 62 + v + q + v));
+c = ((66 + (151 + r) + (s * -57 * d)) + (t + -252) + (11 * 149) + -141 + ((q + 65 + p) + (-261 + w + -32 + r) + (140 + 13)));
+e = -147 * -130 * r * q + 296 * -178 + -234;
+b = b;
+f = ((-236 + t + 23 + -131 + t) + (w + q) + 212 + u + r + e + (-139 * 82 * e * 181) + r + h + 114 + s + 94 + c + e + u);
+g = ((200 + t + (c * q * u * -4)) + 191 + -110 + (294 * 17 * q * (s + 86) * (-59 * -79 * -187)));
+a = (((-120 * p * 70) + f + r + 250 + e + p + p + -113) * -254 + -134 + 25 * -41 + 26 + f + 266 * u * ((283 + w + -230) * d * e * s * -11));
+c = b + ((u + 177) * -164 + 1 + q + -117 * (-291 + s + -71 + q) * p + -238 + q) + -111;
+f = (p + 22 + (s + q)) + 247 + q * 33 * 58 * v + v + (u + w + s + 180 * (b * w * -157) * -94 * (-36 + -10 + -170));
+d = t * (a + v + 53) * ((a + 83 + v + q) + (148 + p + 76) + t + 25) * 233 + (t + p) + (v * w * t * w);
+println(((p * p * (151 * a * r) * 255 * u) * (-57 + 89) * 224));
+c = 224;
+f = (v * w * -46 + (g + 245 + r + 123) + 36 + v) + (88 + v + u + t + h);
+c = ((182 + v + f + 27 * s * 2 + 67) + w + (u + -299 + -111) + p);
+g = -278;
+f = -58;
+h = (((u + p + v) * t * (r + u + 274 + c) * 131 * 114 * 40 * -245) + t + 242 + -251 + -209 + v + -256 + 62 + (v + -33));
+println(d + (-46 * w * -25) + h + 137 + 102 + p + 152 + s + 5 + 16 + d);
+c = 196 + h + p + -216 + (s + r) + (u + v + 1 + (185 + w + -57 + -73));
+e = 296 + (p + (28 + 53 + v + -76) + s * -72 * a + -227 + t + h + a) + -129 + -63 + c + t + -9 + (s + -275 + t + q) + (t * -275);
+println(-211);
+println((-225 + u * (w * u * 279 * -272)) + (u + 31 + e * g * (-23 * -264)) + -60 + (p * -50 * -235) * (154 + 186 + q + -80) * p);
+d = (w * v * t * f) * p * p + -59 + (157 + w + -291) * (v + t + 280) * (b * 26);
+g = 243;
+c = (192 * -85 + r * g + (-254 * p * d)) * (30 + d + b * q * s) * (c + 25 + -30);
+f = 143;
+println(191 * 185 * t * (q + 268 + 170 + -106) + 125 * 195 * s * 97 + -64 * e * p * 277 + s * -252 * -251);
+h = (207 + (-169 + 112 + b)) + -244 + (-94 + 81 + 111 + 79);
+b = 15;
+g = ((t + 210 + -24) + 133 + t + (g + -276)) + ((e + 120 + q + s) + (r + q + t)) + w + c + f + (226 + 286 + v + -122 * 81);
+g = r;
+d = q + (124 + p + 160 + -127) + (v * 85 * u * g) + (-197 + v + q + 148) + 88 + (299 * -241) + g + 72 + -104 + u + -26 + -17 + -268 + -63 + -243 + u;
+f = (s + (151 * w) + (t + 135 + w) + c + -256 + s + u) + t + (v + q) + r + -215 + t;
+a = 247 + s + -184 + w + c + (e + -165) + (w * -228 * (-209 + q) * (c * -62 * -82 * 300)) + -102 * (-24 + s) * (261 + t + a);
+b = p;
+c = f;
+d = -132 + u + 157 + 94 + ((168 + 112 + t) + f + (204 + 162 + -217 + -71));
+h = 251;
+c = u * (a + 86 + -6 + v) * -14 * (g + b + v + v) + (-224 + r) + (a + v) + 229 + (a * -5 * w);
+g = f;
+h = 34 + e + -158 + w * 217 * s * 43 + ((-235 * 225) + (u + 50 + -157) + d) + (w + 94 + c + -189) * (t + s + 179) + -117;
+println(137);
+g = (s + v + (d * 61) + v);
+h = (((-190 + 240) * (-134 + 181 + p) * v * -120 * 158) * -148 * 30 * ((r + -21) * 184 * p));
+f = s;
+h = (q + -187 + (t + -220) + (f + g + 135) + 145);
+c = (204 * s + t);
+g = 51 + e + -87 + p;
+d = b + 210 + -217 + s + (v * 245) + -93 + (c + -19) + (48 + r + -33 + t) + (-285 * (287 * v) * (-162 + 127 + q) * u + 105 + v + t);
+g = t;
+d = -4 + -194 + t + (-29 + 212 + -85 + 241) + 275 * -225 * f * q * v * -255 * -160 * w + 252 + -16 + (g * b) + 218 * u;
+b = r;
+println(q);
+h = 68 + -118 + -110 + 30 + s * (v + w + s + u) * q + t + -169;
+c = (r + (r + g + c) + (-4 * 278) + (-123 + a)) + (-82 + t + -174 + 8) * -1 * 135 + u + r * w + (297 * -178 * -291) + (w + c);
+a = ((q + c + -119) * 117) + p + 115 + r + 296 + r + 154 + 223 * p * b + r + 265 + q + 143 + -215;
+a = s + (59 + (-256 + t + -102)) + (r + v + -250 + 213 + -300 * f * -196 * q);
+e = (r * 209 + -82 + w + -235 + (w * w * r * q) * (-260 * p * -284));
+g = e + 265 + p + -116 + (s * u * 79 * -293) * (-6 + t + p) + 99 + p + 272 + -227 + 161 * s * (37 + 222 + a + t + (p + p + p) + (r + w));
+e = f;
+d = -151;
+h = (-114 + (-168 + 123 + q) + r + -241 + e + s) + (v + 49 + 46 + 164 + (t * w * 106) + (r + q));
+println((((a + r + 102 + -226) + 292 + (s + -255 + 24) + s + r + 63 + 151) + (w + 136) * g * -226 * q * -215 + s + t));
+println(-195);
+println((q * p * -232 * e) + (218 + -105 + -197) + -14 + -214 + 52 + u * b * v * 115 * -213 * (r + s + p + (t + h + s + r) + (c + -5)) * q);
+h = ((d + 3 + r) + -44 + 89 + v + u + (85 + v + 182 + w) * 0 + w + p + v + a + q);
+d = 289 + 270 + p + w + (-102 + p) + (p + 101 + w + -136) + -178 + -86 + ((124 + -285 + -234 + 141) * r + -41 + h);
+b = u;
+b = (-85 + -235 + (152 * s));
+d = ((-226 * 16 * a * 195) * p * (a + -134 + p + p)) + p + t + 20 + e + p + e;
+println(((r + p + -195 * (r + -164 + v + d)) + h + 213 + (258 * 297 * t * -90) + u + s));
+e = -134 + (v + r + q) + (s * -25 * w * r) + p;
+d = h + w + c + -25 + -105 + (t + a + t * -222 * -70 + -3 * 7 + (208 + v + -17));
+println((215 + q + -197 * t + q * (-63 + b + t + 276)) * p * (w + r + r * -211 + -278 + 91 + 101));
+c = (-51 * -262 * -124 * -268 + p * p * 183 * -29 + -217 + u);
+f = -172;
+a = (b + ((-7 * a) + u) + (v + -142 + 227 + -46 * 128 * f));
+e = e + (-189 + (t + u + r + -132));
+c = (t + b + (a * q * p * t)) * 252 + r + r + -225 * (r + 161) * t * w * -214 * 125 + p + 62 * 263 * -237 * f * q;
+a = 99 + v + (q + -62) + 70 + -211 + v;
+d = ((s + 53) + 112 + 117 + 64 * 187 + 167 + s + -279 + -2);
+println(a + b + c + d + e + f + g + h);
@@ -0,0 +1,10 @@
+println(1);
+print(2 + 3);
+print(-4);
+println(10 * 10);
+x = 7;
+println(x);
+print(5);
+println(8);
+println(x + 1);
+{ println(1); println(2); println(3); println(4); println(5); }
@@ -0,0 +1,60 @@
+c = f;
+b = c + c * d * e * (g + c) * d + e * ((d + 24) + (h * d));
+f = 64 + h + c + b + g + c + g;
+a = c;
+a = (d * c + ((a + (h * c)) + (a * a + (h + h))));
+c = e;
+f = (g + g) * h * h + b * (d + f * h + c + e + b * 61 * h);
+h = a;
+d = b + (f * f * c) * (g * e) * d * h * c + (a + c);
+println(((a * a + c) * c) + e);
+f = (a * h) + g * a * (d * (h * c)) + (d + f + a + e + g + (a + e));
+g = e;
+g = (f + g);
+b = b * h + ((g * d) + g) * b;
+c = e;
+a = (e * e);
+f = (c + d * f + e + h + c + (c + g)) + (c * f * f * e) * (a + e) * b + b;
+println((e * c) * c * h + (h * c * f * h) * (a * d) + a * b + a + e + c + a);
+println(a);
+e = a;
+h = c;
+d = (f + a + g * d * c + (g + f) * (g * h) + a);
+println(((g + g) + g) * f * e * f + a + b * e * b * d + g * c + c);
+println(b);
+h = g;
+println(b);
+g = (b + f + g + (a + g * e + f) + g * h * b + c * f);
+d = d;
+d = ((a + h) + (d * d) * b + d);
+d = ((b + b * e + d) * f * e + a * f + b + 30 + d * h);
+f = (a + (31 + c + b + f));
+c = g;
+println(f);
+f = (c + (c * c)) + b + (h * a * g * f * (h + g) * b + e);
+println(c * a * (g * d) * c * a);
+h = (c * (e * h) + f * h + d * 70) * ((d * e) * h + a) + d;
+f = (73 + e) + a + (c * e + c * h) + f * d * f + (g * d);
+c = (b + a * f * c + a * a * b) * (d * (d * e) * c * f);
+h = ((h * (a * e)) + h) * e * 98 * g * (89 + d * (e * a));
+d = ((b + a) * a + a * f + b + (g * e) * g * a);
+a = b + (a + d + d) + d;
+d = d * a * a + a + e + a * e * g;
+g = (e + g + g) * e + h * e * h + (b + d + g + e) + b;
+h = (d + e + (c + c)) + (g + d) * c + 69 + (c + g * c * g);
+c = b + g + ((d * g) + h) + (a * f + b * d * d);
+g = h;
+c = a + b + e + a * a;
+e = h + f * a + d * a * h + d;
+g = (b + ((a + e) + f * d + d * (a + g)));
+h = ((h * h) + h) + (g + 9 * h) + ((21 + g) * a);
+a = (((23 * 1 * h * h) * b + f * h) + c);
+a = (h * d) * g * a + c + c;
+println(((d * f) * 17 + b + f));
+c = ((a + c) * c + e + g * c + a * h * b * (f + c * g + f));
+println((e * f) + d * f * b + g * a + c + (f + ((a + h) * h)));
+println(g);
+println((a + c + (b * e)) * h + c * g + c * g * g);
+b = (g + (a + f) + c) * ((41 + e) * h) * 60 * c + e;
+println(g * a * e * b + d * (e + d) + ((e * f) * (g * d)));
+c = h + c * (c + f + f * a) * ((a * b) + d * a * b + f * (c * f));
@@ -0,0 +1,159 @@
+a = 67;
+b = 45;
+c = 74;
+d = 3;
+e = 29;
+f = 3;
+g = 49;
+h = 46;
+b = b;
+e = e + f;
+c = c + 2;
+a = a + 3;
+b = a * 7 + e;
+a = g * 4 + e;
+f = f + 4;
+c = c + 3;
+g = g * g + 2;
+b = b + 2;
+println(e);
+e = e + d;
+g = f * 9 + b;
+h = h + g;
+println(f);
+e = e + 3;
+e = e + 5;
+e = e + 9;
+e = e + 7;
+g = g;
+e = e;
+f = h * 3 + b;
+f = g * 7 + c;
+g = f * 9 + f;
+a = e * 2 + c;
+e = e + 2;
+println(h);
+e = c * 9 + c;
+f = f;
+g = c * 3 + h;
+c = c + 3;
+h = h + 9;
+h = a * 8 + h;
+g = g * c + 2;
+g = g + 9;
+c = c + 9;
+d = d + g;
+println(e);
+e = e + b;
+c = e * 3 + e;
+b = b + 8;
+e = e + d;
+f = f + b;
+f = f;
+println(e);
+f = a * 7 + e;
+g = g;
+a = a + a;
+b = b + 7;
+println(e);
+println(g);
+println(a);
+h = h + 7;
+h = h + 5;
+a = d * 8 + f;
+f = b * 9 + g;
+d = d + 4;
+d = d + 1;
+a = e * 7 + d;
+e = e + 6;
+h = h;
+e = h * 6 + f;
+d = d + b;
+c = c + 4;
+h = h + g;
+d = d + 9;
+e = e + c;
+h = h + 3;
+e = f * 4 + e;
+f = f + h;
+println(e);
+b = b + g;
+b = c * 3 + f;
+e = e * a + 1;
+a = e * 6 + e;
+h = h + 3;
+d = d;
+c = c * g + 3;
+d = d + 6;
+g = g + 5;
+println(b);
+e = e + 3;
+h = h + a;
+println(a);
+g = g + b;
+a = a;
+println(b);
+g = g + h;
+g = g;
+b = b * 3 + h;
+f = d * 2 + b;
+e = e + g;
+c = c;
+d = d + g;
+c = c * d + 1;
+b = g * 4 + d;
+d = h * 7 + b;
+b = b + f;
+g = g + 6;
+f = f + d;
+f = f + 7;
+e = b * 8 + h;
+e = d * 2 + f;
+e = d * 8 + g;
+f = f + h;
+g = e * 4 + d;
+f = f + 4;
+c = c * e + 2;
+g = g + 1;
+h = h;
+e = e;
+f = f + 5;
+e = g * 4 + b;
+println(d);
+h = h + g;
+g = g + 5;
+f = c * 3 + c;
+println(c);
+a = a;
+d = d + h;
+println(a);
+e = e + f;
+b = b * d + 3;
+d = d + 6;
+g = g * 6 + f;
+b = b + g;
+d = d + 3;
+h = h + 6;
+println(a);
+e = e + 8;
+e = e * g + 2;
+f = f + h;
+a = a + 6;
+e = e + c;
+c = c + a;
+a = a + h;
+g = g + f;
+a = a + 9;
+println(f);
+b = b + c;
+d = d * d + 4;
+c = c + 4;
+g = g + e;
+h = h + 7;
+e = e + 8;
+c = f * 8 + f;
+c = c + 3;
+a = a + 1;
+println(f);
+f = c * 7 + f;
+println(a + b + c + d + e + f + g + h);
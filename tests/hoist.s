@@ -0,0 +1,11 @@
+// test: L9 | H1 | ^Loop
+// hoisting: a * b + c does not change in the loop and is computed
+// once, ahead of it
+a = 3;
+b = 4;
+c = 5;
+i = 0;
+j = 20;
+s = 0;
+while (i < j) { s = s + a * b + c + i; i = i + 1; j = j - 1; }
+println(s);
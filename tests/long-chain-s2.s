@@ -0,0 +1,505 @@
+// test: S2 | H1
+// chains of more than 180 operands, over many lines
+a = 2;
+x = a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    a +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    1 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3 +
+    a - 3;
+println(x);
+y = a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a *
+    a;
+println(y);
@@ -0,0 +1,10 @@
+// test: S2 --object | H1 --object
+// a program written as a binary .ho object and loaded by H1
+x = 7;
+y = x * x - 5;
+print(y);
+print(1);
+println(2);
+z = y / (x - 4);
+println(z + 1000);
+println(-32768 - 1);
@@ -0,0 +1,39 @@
+#!/bin/sh
+# Run each test program tests/name.s and compare its output with
+# tests/name.out.  The first line of name.s says how to build and
+# run it, for example
+#     // test: L9 -O2 | H1 | ^Loop
+# compiles name.s with L9 -O2 and runs name on H1.  The optional
+# third field is a grep pattern: the lines of the compiler's output
+# that match it come ahead of the program's output.  Run from the
+# top of the tree.
+dir=$(mktemp -d) || exit 1
+for c in S2 L9 R1 H1
+do
+    if ! cc -O2 -o $dir/$c $c.c 2> /dev/null
+    then
+        echo "cannot build $c"
+        exit 1
+    fi
+done
+status=0
+for s in tests/*.s
+do
+    name=$(basename $s .s)
+    test=$(sed -n '1s|^// test: *||p' $s)
+    compile=$(echo $(echo "$test" | cut -d'|' -f1))
+    run=$(echo $(echo "$test" | cut -d'|' -f2))
+    report=$(echo "$test" | cut -d'|' -s -f3 | sed 's/^ *//; s/ *$//')
+    cp $s $dir
+    if (cd $dir && ./$compile $name > $name.log &&
+        { [ -z "$report" ] || grep "$report" $name.log; } &&
+        ./$run $name 2>&1) | cmp -s - tests/$name.out
+    then
+        echo "ok   $name"
+    else
+        echo "FAIL $name"
+        status=1
+    fi
+done
+rm -rf $dir
+exit $status
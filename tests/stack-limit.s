@@ -0,0 +1,11 @@
+// test: S2 --stack-limit=4 --stack-report | H1 | ^limit
+// --stack-limit: a statement that needs more stack words than the
+// limit spills operands to @s temps and still computes its value
+a = 2;
+b = 3;
+c = 4;
+d = 5;
+x = a * (b + c * (d - a * (b - c * (d + 1))));
+println(x);
+y = (a - b) * (c - d) + (a + c) * (b + d) - (a * d) * (b * c);
+println(y);
@@ -0,0 +1,14 @@
+// test: L9 | H1 | ^Loop
+// unrolling: a loop unrolled fully, one unrolled by a factor with
+// copies ahead of it, and one whose trip count is unknown
+i = 0;
+s = 0;
+while (i < 5) { s = s + i; i = i + 1; }
+println(s);
+i = 0;
+while (i < 1003) { s = s + i; i = i + 1; }
+println(s);
+j = 0;
+k = 10;
+while (j < k) { j = j + 1; k = k - 1; }
+println(j);
@@ -0,0 +1,23 @@
+// test: L9 | H1
+// comparisons whose operands are more than 32767 apart
+x = 30000;
+y = -30000;
+n = 0;
+while (x > y) { x = x - 10000; n = n + 1; }   // trip count 6
+println(n);
+x = 30000;
+n = 0;
+while (x > y) { x = x - 10000; y = y + 1; n = n + 1; }
+println(n);
+a = -30000;
+b = 20000;
+n = 0;
+while (a < 30000) { a = a + b; b = b + 0; n = n + 1; }
+println(n);
+n = 0;
+while (-30000 >= a - 1) { a = a + 1; n = n + 1; }
+println(n);
+a = -32768;
+n = 0;
+while (a <= 0 - 32767) { a = a + 1; n = n + 1; }   // trip count 2
+println(n);